@@ -0,0 +1,935 @@
+/**
+ * batch.c
+ * Toplu (batch) komut çalıştırma fonksiyonlarının implementasyonları
+ */
+
+#define _GNU_SOURCE
+#include "batch.h"
+#include "executor.h"
+#include "file_operations.h"
+#include "io_ring.h"
+#include "logger.h"
+#include "utils.h"
+#include <stdint.h>
+#include <sys/uio.h>
+
+/**
+ * Satır okuyucu durumu
+ */
+typedef struct {
+    int fd;
+    char buffer[BATCH_BUFFER_SIZE];
+    size_t start;
+    size_t end;
+    int eof;
+} LineReader;
+
+// Okuyucu büyük olduğu için yığın yerine statik bellekte tutulur
+static LineReader reader;
+
+/**
+ * Monoton saatten mikro saniye cinsinden zaman döndürür
+ */
+static long long monotonicMicros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+/**
+ * Bir sonraki satırı okur
+ * 
+ * @return 1: Satır okundu, 0: Girdi bitti, -1: Okuma hatası, -2: Satır çok uzun
+ */
+static int readLine(LineReader* r, char** line) {
+    int tooLong = 0;
+    
+    for (;;) {
+        char* newline = memchr(r->buffer + r->start, '\n', r->end - r->start);
+        if (newline != NULL) {
+            *newline = '\0';
+            *line = r->buffer + r->start;
+            r->start = (size_t)(newline - r->buffer) + 1;
+            return tooLong ? -2 : 1;
+        }
+        
+        if (r->eof) {
+            if (r->start < r->end) {
+                r->buffer[r->end] = '\0';
+                *line = r->buffer + r->start;
+                r->start = r->end;
+                return tooLong ? -2 : 1;
+            }
+            return tooLong ? -2 : 0;
+        }
+        
+        // Tamamlanmamış satırı buffer'ın başına taşı
+        if (r->start > 0) {
+            memmove(r->buffer, r->buffer + r->start, r->end - r->start);
+            r->end -= r->start;
+            r->start = 0;
+        }
+        
+        // Satır buffer'a sığmıyor, satır sonuna kadar at
+        if (r->end == sizeof(r->buffer) - 1) {
+            tooLong = 1;
+            r->end = 0;
+        }
+        
+        ssize_t bytesRead = read(r->fd, r->buffer + r->end, sizeof(r->buffer) - 1 - r->end);
+        if (bytesRead < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (bytesRead == 0) {
+            r->eof = 1;
+        }
+        r->end += (size_t)bytesRead;
+    }
+}
+
+/**
+ * Toplu çalıştırmanın sayaçları
+ */
+typedef struct {
+    int total;
+    int failed;
+    ErrorCode firstError;
+} BatchTotals;
+
+/**
+ * Komutun durumunu standart hataya yazar ve sayaçlara işler
+ */
+static void reportCommand(BatchTotals* totals, int lineNo, const char* verb, ErrorCode result, long long elapsed) {
+    char msg[MAX_CONTENT_LENGTH];
+    int len;
+    
+    if (result == SUCCESS) {
+        len = string_format(msg, sizeof(msg), "[%d] OK: %s (%lld us)\n", lineNo, verb, elapsed);
+    } else {
+        totals->failed++;
+        if (totals->firstError == SUCCESS) {
+            totals->firstError = result;
+        }
+        len = string_format(msg, sizeof(msg), "[%d] HATA: %s: %s (%lld us)\n", lineNo, verb, getErrorMessage(result), elapsed);
+    }
+    write(STDERR_FILENO, msg, len);
+}
+
+static BatchBackend batchBackend = BATCH_BACKEND_SYNC;
+
+/**
+ * Toplu çalıştırmanın arka ucunu ayarlar
+ */
+void setBatchBackend(BatchBackend backend) {
+    batchBackend = backend;
+}
+
+/**
+ * io_uring penceresinde bekleyen komut
+ */
+typedef struct {
+    Command cmd;
+    int lineNo;
+    char verb[32];
+    char* data;             // readFile için okuma buffer'ı
+    char* content;          // appendToFile içeriğinin kopyası (okuyucu buffer'ı yeniden kullanılır)
+    char stamp[100];        // createFile için oluşturulma zamanı satırı
+    struct iovec iov[2];
+    struct statx stx;       // Silmeden önceki varlık denetiminin sonucu
+    int fd;                 // Yazılan dosyanın kilidi tutan tanımlayıcısı (-1: yok)
+    int res[3];             // Zincirdeki isteklerin sonuçları: açma/varlık denetimi/yazma, okuma/silme/kapatma, kapatma
+    int completions;        // Alınan tamamlanma kaydı sayısı
+    long long finishedMicros;
+} RingCommand;
+
+/**
+ * Birlikte gönderilecek komutlar
+ */
+typedef struct {
+    IoRing* ring;
+    RingCommand commands[BATCH_RING_WINDOW];
+    int count;
+    char* readBuffers;      // Komut başına BATCH_RING_READ_SIZE bayt
+    int inFlight;           // Halka hata verdi, çekirdek buffer'ları hâlâ kullanıyor olabilir
+} RingWindow;
+
+/**
+ * io_uring penceresini açar
+ * 
+ * @return Pencere, io_uring kullanılamıyorsa NULL
+ */
+static RingWindow* openRingWindow() {
+    static const unsigned char ops[] = {
+        IORING_OP_OPENAT, IORING_OP_CLOSE, IORING_OP_READ, IORING_OP_WRITE,
+        IORING_OP_WRITEV, IORING_OP_STATX, IORING_OP_UNLINKAT, IORING_OP_MKDIRAT
+    };
+    
+    // Yalıtım modunda işlemler çocuk işlemlerde çalışmalı
+    if (getIsolationMode()) {
+        return NULL;
+    }
+    
+    RingWindow* window = calloc(1, sizeof(RingWindow));
+    if (window != NULL) {
+        window->readBuffers = malloc((size_t)BATCH_RING_WINDOW * BATCH_RING_READ_SIZE);
+    }
+    if (window == NULL || window->readBuffers == NULL ||
+        createIoRing(BATCH_RING_ENTRIES, BATCH_RING_WINDOW, ops, sizeof(ops), &window->ring) != SUCCESS) {
+        logMessage(LOG_WARNING, "io_uring kullanılamıyor, komutlar senkron çalıştırılıyor");
+        if (window != NULL) {
+            free(window->readBuffers);
+            free(window);
+        }
+        return NULL;
+    }
+    
+    return window;
+}
+
+/**
+ * io_uring penceresini kapatır
+ */
+static void closeRingWindow(RingWindow* window) {
+    if (window == NULL) {
+        return;
+    }
+    destroyIoRing(window->ring);
+    if (window->inFlight) {
+        // Tamamlanmamış okumalar buffer'lara yazabilir; bellek bırakılmaz
+        return;
+    }
+    free(window->readBuffers);
+    free(window);
+}
+
+/**
+ * Komutun io_uring ile çalıştırılıp çalıştırılamayacağını döndürür
+ */
+static int isRingCommand(const Command* cmd) {
+    // Halka üzerinden açılan dosyalar fcntl kilidi alamaz. Yazan komutların
+    // dosyası bu yüzden senkron açılıp kilitlenir, yalnızca yazma ve kapatma
+    // halkaya gider. Özel modda senkron readFile de kilit almaz; paylaşımlı
+    // modda aldığından senkron çalışır.
+    int unlockedRead = (getLockMode() == LOCK_MODE_EXCLUSIVE);
+    
+    switch (cmd->type) {
+        case CMD_CREATE_DIR:
+        case CMD_DELETE_FILE:
+        case CMD_CREATE_FILE:
+            return 1;
+        case CMD_DELETE_DIR:
+            return !(cmd->flags & CMD_FLAG_RECURSIVE);
+        case CMD_APPEND_TO_FILE:
+            return cmd->content != NULL && !(cmd->flags & (CMD_FLAG_STDIN | CMD_FLAG_FROM_FILE));
+        case CMD_READ_FILE:
+            return unlockedRead && cmd->offset == 0 && cmd->length == -1 && !(cmd->flags & (CMD_FLAG_HEAD | CMD_FLAG_TAIL | CMD_FLAG_FOLLOW));
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Yolu "." ve boş bileşenlerden arındırır
+ */
+static void normalizePath(const char* path, char* out, size_t size) {
+    const char* p = path;
+    size_t len = 0;
+    
+    while (*p != '\0') {
+        const char* start = p;
+        while (*p != '\0' && *p != '/') {
+            p++;
+        }
+        size_t n = (size_t)(p - start);
+        if (n > 0 && !(n == 1 && start[0] == '.') && len + n + 2 < size) {
+            if (len > 0 || path[0] == '/') {
+                out[len++] = '/';
+            }
+            memcpy(out + len, start, n);
+            len += n;
+        }
+        while (*p == '/') {
+            p++;
+        }
+    }
+    out[len] = '\0';
+}
+
+/**
+ * İki yolun aynı dosyayı veya biri diğerinin altını gösterebileceğini döndürür.
+ * Karşılaştırma sözcükseldir; ".." içeren veya biri mutlak diğeri göreli olan
+ * yollar çakışıyor sayılır.
+ */
+static int pathsMayOverlap(const char* a, const char* b) {
+    char na[MAX_PATH_LENGTH + 2];
+    char nb[MAX_PATH_LENGTH + 2];
+    
+    if ((a[0] == '/') != (b[0] == '/') || strstr(a, "..") != NULL || strstr(b, "..") != NULL) {
+        return 1;
+    }
+    
+    normalizePath(a, na, sizeof(na));
+    normalizePath(b, nb, sizeof(nb));
+    
+    size_t la = strlen(na);
+    size_t lb = strlen(nb);
+    size_t shorter = (la < lb) ? la : lb;
+    if (shorter == 0 || strncmp(na, nb, shorter) != 0) {
+        return shorter == 0;
+    }
+    return la == lb || (la > lb ? na[shorter] : nb[shorter]) == '/';
+}
+
+/**
+ * Komutun isteklerini gönderim kuyruğuna ekler. readFile için açma, okuma ve
+ * kapatma zincirlenir; dosya pencere sırasına karşılık gelen sabit dosya
+ * yuvasına açılır. Yazan komutların dosyası bu yuvaya önceden kilitlenip
+ * yerleştirilmiştir; yazma ve kapatma zincirlenir. Silmeden önce yolun varlığı
+ * statx ile denetlenir, yol yoksa silme iptal edilir.
+ */
+static void queueRingCommand(RingWindow* window, int index) {
+    RingCommand* rc = &window->commands[index];
+    struct io_uring_sqe* sqe = getIoRingSqe(window->ring);
+    unsigned long long userData = (unsigned long long)index << 2;
+    
+    rc->res[0] = rc->res[1] = rc->res[2] = 0;
+    rc->completions = 0;
+    sqe->fd = AT_FDCWD;
+    sqe->addr = (unsigned long long)(uintptr_t)rc->cmd.arg1;
+    sqe->user_data = userData;
+    
+    switch (rc->cmd.type) {
+        case CMD_CREATE_DIR:
+            // mkdirat'ın EEXIST sonucu varlık denetimidir; ayrı statx gerekmez
+            sqe->opcode = IORING_OP_MKDIRAT;
+            sqe->len = 0755;
+            return;
+        case CMD_DELETE_FILE:
+        case CMD_DELETE_DIR:
+            sqe->opcode = IORING_OP_STATX;
+            sqe->len = STATX_TYPE;
+            sqe->off = (unsigned long long)(uintptr_t)&rc->stx;
+            sqe->flags = IOSQE_IO_LINK;
+            
+            sqe = getIoRingSqe(window->ring);
+            sqe->fd = AT_FDCWD;
+            sqe->addr = (unsigned long long)(uintptr_t)rc->cmd.arg1;
+            sqe->user_data = userData | 1;
+            sqe->opcode = IORING_OP_UNLINKAT;
+            sqe->unlink_flags = (rc->cmd.type == CMD_DELETE_DIR) ? AT_REMOVEDIR : 0;
+            return;
+        case CMD_CREATE_FILE:
+        case CMD_APPEND_TO_FILE:
+            // Yazma kısa kalsa da yuva boşalsın diye sert bağlantı kullanılır
+            sqe->fd = index;
+            sqe->flags = IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK;
+            if (rc->cmd.type == CMD_CREATE_FILE) {
+                sqe->opcode = IORING_OP_WRITE;
+                sqe->addr = (unsigned long long)(uintptr_t)rc->stamp;
+                sqe->len = (unsigned)strlen(rc->stamp);
+            } else {
+                sqe->opcode = IORING_OP_WRITEV;
+                sqe->addr = (unsigned long long)(uintptr_t)rc->iov;
+                sqe->len = 2;
+                sqe->off = (unsigned long long)-1;
+            }
+            
+            sqe = getIoRingSqe(window->ring);
+            sqe->opcode = IORING_OP_CLOSE;
+            sqe->file_index = (unsigned)index + 1;
+            sqe->user_data = userData | 1;
+            return;
+        default:
+            break;
+    }
+    
+    // Açma başarısız olursa zincirin kalanı iptal edilir
+    sqe->opcode = IORING_OP_OPENAT;
+    sqe->file_index = (unsigned)index + 1;
+    sqe->flags = IOSQE_IO_LINK;
+    sqe->open_flags = O_RDONLY;
+    
+    // Okuma kısa kalsa da kapatma çalışsın diye sert bağlantı kullanılır
+    sqe = getIoRingSqe(window->ring);
+    sqe->fd = index;
+    sqe->flags = IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK;
+    sqe->user_data = userData | 1;
+    sqe->opcode = IORING_OP_READ;
+    sqe->addr = (unsigned long long)(uintptr_t)rc->data;
+    sqe->len = BATCH_RING_READ_SIZE;
+    
+    sqe = getIoRingSqe(window->ring);
+    sqe->opcode = IORING_OP_CLOSE;
+    sqe->file_index = (unsigned)index + 1;
+    sqe->user_data = userData | 2;
+}
+
+/**
+ * Komutun istek sayısını döndürür
+ */
+static int ringRequestCount(const RingCommand* rc) {
+    switch (rc->cmd.type) {
+        case CMD_CREATE_DIR:
+            return 1;
+        case CMD_DELETE_FILE:
+        case CMD_DELETE_DIR:
+        case CMD_CREATE_FILE:
+        case CMD_APPEND_TO_FILE:
+            return 2;
+        default:
+            return 3;
+    }
+}
+
+/**
+ * Tamamlanan komutun sonucunu senkron işlemlerle aynı log kayıtlarıyla işler
+ */
+static ErrorCode finishRingCommand(RingCommand* rc) {
+    const char* name = rc->cmd.arg1;
+    int res = rc->res[0];
+    
+    switch (rc->cmd.type) {
+        case CMD_CREATE_DIR:
+            if (res == -EEXIST) {
+                logEvent(LOG_ERROR, OP_DIR_EXISTS, name);
+                return ERROR_FILE_EXISTS;
+            } else if (res < 0) {
+                logEvent(LOG_ERROR, OP_DIR_CREATE_ERROR, name);
+                return ERROR_UNKNOWN;
+            }
+            logEvent(LOG_INFO, OP_DIR_CREATED, name);
+            return SUCCESS;
+        
+        case CMD_DELETE_FILE:
+            if (res < 0) {
+                logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, name);
+                return ERROR_FILE_NOT_FOUND;
+            } else if (rc->res[1] < 0) {
+                logEvent(LOG_ERROR, OP_FILE_DELETE_ERROR, name);
+                return ERROR_UNKNOWN;
+            }
+            logEvent(LOG_INFO, OP_FILE_DELETED, name);
+            return SUCCESS;
+        
+        case CMD_DELETE_DIR:
+            // Dizin olmayan yol için silme ENOTDIR ile başarısız olmuştur
+            if (res < 0 || !S_ISDIR(rc->stx.stx_mode)) {
+                logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, name);
+                return ERROR_FILE_NOT_FOUND;
+            } else if (rc->res[1] == -ENOTEMPTY || rc->res[1] == -EEXIST) {
+                logEvent(LOG_ERROR, OP_DIR_NOT_EMPTY, name);
+                return ERROR_DIR_NOT_EMPTY;
+            } else if (rc->res[1] < 0) {
+                logEvent(LOG_ERROR, OP_DIR_DELETE_ERROR, name);
+                return ERROR_UNKNOWN;
+            }
+            logEvent(LOG_INFO, OP_DIR_DELETED, name);
+            return SUCCESS;
+        
+        case CMD_CREATE_FILE:
+            if (res != (int)strlen(rc->stamp)) {
+                logEvent(LOG_ERROR, OP_FILE_WRITE_ERROR, name);
+                return ERROR_UNKNOWN;
+            }
+            logEvent(LOG_INFO, OP_FILE_CREATED, name);
+            return SUCCESS;
+        
+        case CMD_APPEND_TO_FILE:
+            if (res != (int)(rc->iov[0].iov_len + 1)) {
+                logEvent(LOG_ERROR, OP_FILE_WRITE_ERROR, name);
+                return ERROR_UNKNOWN;
+            }
+            logEvent(LOG_INFO, OP_FILE_APPENDED, name);
+            return SUCCESS;
+        
+        default:
+            if (res == -ENOENT) {
+                logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, name);
+                return ERROR_FILE_NOT_FOUND;
+            } else if (res < 0) {
+                logEvent(LOG_ERROR, OP_FILE_OPEN_ERROR, name);
+                return ERROR_UNKNOWN;
+            } else if (rc->res[1] < 0) {
+                logEvent(LOG_ERROR, OP_FILE_READ_ERROR, name);
+                return ERROR_UNKNOWN;
+            } else if (rc->res[1] == BATCH_RING_READ_SIZE) {
+                // Buffer'a sığmayan dosya senkron olarak baştan okunur
+                return executeCommand(&rc->cmd);
+            }
+            
+            const char* header = "\n--- Dosya İçeriği ---\n";
+            const char* footer = "\n--------------------\n";
+            write(getOutputFd(), header, strlen(header));
+            write(getOutputFd(), rc->data, (size_t)rc->res[1]);
+            write(getOutputFd(), footer, strlen(footer));
+            logEvent(LOG_INFO, OP_FILE_READ, name);
+            return SUCCESS;
+    }
+}
+
+/**
+ * Tamamlanma kaydının sonucunu ait olduğu komuta yazar
+ */
+static void recordRingCompletion(RingWindow* window, const struct io_uring_cqe* cqe) {
+    RingCommand* done = &window->commands[cqe->user_data >> 2];
+    done->res[cqe->user_data & 3] = cqe->res;
+    done->completions++;
+    done->finishedMicros = monotonicMicros();
+}
+
+/**
+ * Penceredeki komutları tek gönderimde çalıştırır ve sonuçlarını komut
+ * sırasıyla raporlar
+ */
+static void flushRingWindow(RingWindow* window, BatchTotals* totals) {
+    struct io_uring_cqe cqe;
+    int expected = 0;
+    int completed = 0;
+    int failed = 0;
+    
+    if (window == NULL || window->count == 0) {
+        return;
+    }
+    
+    long long startTime = monotonicMicros();
+    
+    for (int i = 0; i < window->count; i++) {
+        queueRingCommand(window, i);
+        expected += ringRequestCount(&window->commands[i]);
+    }
+    
+    // Çekirdek girdilerin bir kısmını geçici olarak alamazsa tamamlananlar
+    // alındıktan sonra kalanlar yeniden gönderilir
+    int submitted = 0;
+    while (completed < expected) {
+        int rc = submitIoRing(window->ring);
+        if (rc > 0) {
+            submitted += rc;
+        } else if (rc < 0 && ((rc != -EAGAIN && rc != -EBUSY) || submitted == completed)) {
+            failed = 1;
+            break;
+        }
+        if (waitIoRingCompletion(window->ring, &cqe) != SUCCESS) {
+            failed = 1;
+            break;
+        }
+        recordRingCompletion(window, &cqe);
+        completed++;
+    }
+    
+    // Gönderim başarısız olduysa çekirdeğe ulaşmış isteklerin bitmesi beklenir;
+    // bekleme de başarısızsa buffer'lar pencere kapanınca serbest bırakılmaz
+    while (failed && completed < submitted) {
+        if (waitIoRingCompletion(window->ring, &cqe) != SUCCESS) {
+            window->inFlight = 1;
+            break;
+        }
+        recordRingCompletion(window, &cqe);
+        completed++;
+    }
+    
+    // Tüm istekleri tamamlanan komutlar sonucuna göre, diğerleri hatalı raporlanır.
+    // Yazılan dosyaların kilidi senkron yoldaki gibi log kaydından önce bırakılır;
+    // çekirdek hâlâ yazıyor olabilirse kilit ve içerik tutulur.
+    for (int i = 0; i < window->count; i++) {
+        RingCommand* done = &window->commands[i];
+        int finished = (done->completions == ringRequestCount(done));
+        if (done->fd != -1 && !window->inFlight) {
+            unlockFile(done->fd);
+            close(done->fd);
+            done->fd = -1;
+        }
+        ErrorCode result = finished ? finishRingCommand(done) : ERROR_UNKNOWN;
+        long long elapsed = finished ? done->finishedMicros - startTime : 0;
+        reportCommand(totals, done->lineNo, done->verb, result, elapsed);
+        if (!window->inFlight) {
+            free(done->content);
+            done->content = NULL;
+        }
+    }
+    window->count = 0;
+    
+    // Halkanın durumu bilinmediğinden kalan komutlar senkron çalışır
+    if (failed) {
+        logMessage(LOG_ERROR, "io_uring gönderimi başarısız, komutlar senkron çalıştırılıyor");
+        destroyIoRing(window->ring);
+        window->ring = NULL;
+    }
+}
+
+/**
+ * Yazan komutun dosyasını senkron olarak açar, kilitler ve pencerenin sabit
+ * dosya yuvasına yerleştirir. Pencere başka dosyaların kilitlerini tutarken
+ * kilit beklenmez; kilit başkasındaysa komut, pencere çalıştırılıp kilitler
+ * bırakıldıktan sonra senkron yoldan çalışır.
+ * 
+ * @return 1: Komut pencereye eklenebilir, 0: Komut senkron çalıştırılmalı,
+ *         -1: Komut burada çalıştırılıp raporlandı
+ */
+static int prepareRingWrite(RingWindow* window, BatchTotals* totals, RingCommand* rc) {
+    const char* name = rc->cmd.arg1;
+    int create = (rc->cmd.type == CMD_CREATE_FILE);
+    ErrorCode result;
+    int fd;
+    
+    // Açılamayan dosyanın hatası senkron yolda aynı denetimlerle raporlanır
+    fd = create ? open(name, O_WRONLY | O_CREAT | O_EXCL, 0644) : open(name, O_WRONLY | O_APPEND);
+    if (fd == -1) {
+        return 0;
+    }
+    
+    result = tryLockFileForAppend(fd);
+    if (result == SUCCESS && create) {
+        char timeBuffer[50];
+        getCurrentTimeStamp(timeBuffer, sizeof(timeBuffer));
+        string_format(rc->stamp, sizeof(rc->stamp), "Dosya oluşturulma zamanı: %s\n", timeBuffer);
+    } else if (result == SUCCESS) {
+        size_t length = strlen(rc->cmd.content);
+        rc->content = malloc(length + 1);
+        if (rc->content == NULL) {
+            result = ERROR_UNKNOWN;
+        } else {
+            memcpy(rc->content, rc->cmd.content, length + 1);
+            rc->cmd.content = rc->content;
+            rc->iov[0].iov_base = rc->content;
+            rc->iov[0].iov_len = length;
+            rc->iov[1].iov_base = "\n";
+            rc->iov[1].iov_len = 1;
+        }
+    }
+    if (result == SUCCESS && updateIoRingFiles(window->ring, (unsigned)window->count, &fd, 1) != SUCCESS) {
+        result = ERROR_UNKNOWN;
+    }
+    if (result == SUCCESS) {
+        rc->fd = fd;
+        return 1;
+    }
+    
+    free(rc->content);
+    rc->content = NULL;
+    if (!create) {
+        unlockFile(fd);
+        close(fd);
+        return 0;
+    }
+    
+    // Oluşturulan dosya senkron yoldan yeniden oluşturulamaz; pencere
+    // çalıştırılıp tutulan kilitler bırakıldıktan sonra zaman satırı burada yazılır
+    flushRingWindow(window, totals);
+    long long start = monotonicMicros();
+    result = stampCreatedFile(fd, name);
+    reportCommand(totals, rc->lineNo, rc->verb, result, monotonicMicros() - start);
+    return -1;
+}
+
+/**
+ * Komutu io_uring penceresine ekler. Pencere doluysa veya komut penceredeki
+ * bir komutla aynı yola dokunuyorsa önce pencere çalıştırılır.
+ * 
+ * @return Eklendiyse 1, komut senkron çalıştırılmalıysa 0
+ */
+static int addRingCommand(RingWindow* window, BatchTotals* totals, const Command* cmd, int lineNo, const char* verb) {
+    int overlaps = (window->count == BATCH_RING_WINDOW);
+    for (int i = 0; !overlaps && i < window->count; i++) {
+        overlaps = pathsMayOverlap(window->commands[i].cmd.arg1, cmd->arg1);
+    }
+    if (overlaps) {
+        flushRingWindow(window, totals);
+    }
+    if (window->ring == NULL) {
+        return 0;
+    }
+    
+    RingCommand* rc = &window->commands[window->count];
+    rc->cmd = *cmd;
+    rc->lineNo = lineNo;
+    strncpy(rc->verb, verb, sizeof(rc->verb) - 1);
+    rc->verb[sizeof(rc->verb) - 1] = '\0';
+    rc->data = window->readBuffers + (size_t)window->count * BATCH_RING_READ_SIZE;
+    rc->content = NULL;
+    rc->fd = -1;
+    
+    if (cmd->type == CMD_CREATE_FILE || cmd->type == CMD_APPEND_TO_FILE) {
+        int status = prepareRingWrite(window, totals, rc);
+        if (status <= 0) {
+            return status < 0;
+        }
+    }
+    
+    window->count++;
+    return 1;
+}
+
+/**
+ * Satır satır verilen komutları tek bir işlem içinde sırayla çalıştırır
+ */
+ErrorCode runBatch(const char* commandFile) {
+    char* line;
+    char* args[MAX_BATCH_ARGS + 1];
+    char msg[MAX_CONTENT_LENGTH];
+    Command cmd;
+    ErrorCode result;
+    BatchTotals totals = { 0, 0, SUCCESS };
+    RingWindow* window = NULL;
+    int status;
+    int lineNo = 0;
+    int len;
+    
+    // Komut kaynağını aç
+    reader.start = 0;
+    reader.end = 0;
+    reader.eof = 0;
+    if (commandFile == NULL || commandFile[0] == '\0' || strcmp(commandFile, "-") == 0) {
+        reader.fd = STDIN_FILENO;
+    } else {
+        reader.fd = open(commandFile, O_RDONLY);
+        if (reader.fd == -1) {
+            string_format(msg, sizeof(msg), "Komut dosyası açılamadı: %s", commandFile);
+            logMessage(LOG_ERROR, msg);
+            return ERROR_FILE_NOT_FOUND;
+        }
+    }
+    
+    // Log dosyasını tüm komutlar boyunca açık tut
+    openLogSession();
+    
+    if (batchBackend == BATCH_BACKEND_URING) {
+        window = openRingWindow();
+    }
+    
+    long long startTime = monotonicMicros();
+    
+    while ((status = readLine(&reader, &line)) != 0) {
+        lineNo++;
+        
+        if (status == -1) {
+            totals.firstError = (totals.firstError == SUCCESS) ? ERROR_UNKNOWN : totals.firstError;
+            break;
+        }
+        
+        if (status == -2) {
+            flushRingWindow(window, &totals);
+            totals.total++;
+            totals.failed++;
+            len = string_format(msg, sizeof(msg), "[%d] HATA: satır çok uzun\n", lineNo);
+            write(STDERR_FILENO, msg, len);
+            totals.firstError = (totals.firstError == SUCCESS) ? ERROR_INVALID_ARGUMENT : totals.firstError;
+            continue;
+        }
+        
+        // Boş satırları ve yorumları atla
+        int argc = splitCommandLine(line, args + 1, MAX_BATCH_ARGS);
+        if (argc == 0 || (argc > 0 && args[1][0] == '#')) {
+            continue;
+        }
+        
+        totals.total++;
+        
+        if (argc < 0) {
+            result = ERROR_INVALID_ARGUMENT;
+        } else {
+            args[0] = "file_system";
+            result = parseCommand(argc + 1, args, &cmd);
+            if (result == SUCCESS && (cmd.flags & CMD_FLAG_STDIN) && reader.fd == STDIN_FILENO) {
+                // Standart girdi komutların kendisi
+                result = ERROR_INVALID_ARGUMENT;
+            }
+        }
+        
+        // Bağımsız komutlar pencerede toplanır, durumları pencere çalışınca raporlanır
+        const char* verb = (argc > 0) ? args[1] : "?";
+        if (window != NULL && result == SUCCESS && isRingCommand(&cmd) &&
+            addRingCommand(window, &totals, &cmd, lineNo, verb)) {
+            continue;
+        }
+        flushRingWindow(window, &totals);
+        
+        long long cmdStart = monotonicMicros();
+        if (result == SUCCESS) {
+            result = executeCommand(&cmd);
+        }
+        reportCommand(&totals, lineNo, verb, result, monotonicMicros() - cmdStart);
+    }
+    
+    flushRingWindow(window, &totals);
+    closeRingWindow(window);
+    
+    long long elapsed = monotonicMicros() - startTime;
+    long long perSecond = (elapsed > 0) ? (long long)totals.total * 1000000LL / elapsed : 0;
+    
+    // Toplam verim özeti
+    len = string_format(msg, sizeof(msg),
+                        "Toplu çalıştırma özeti: %d komut, %d başarılı, %d hatalı, %lld ms, %lld komut/sn\n",
+                        totals.total, totals.total - totals.failed, totals.failed, elapsed / 1000, perSecond);
+    write(STDERR_FILENO, msg, len);
+    
+    string_format(msg, sizeof(msg), "Toplu çalıştırma tamamlandı: %d komut, %d hatalı", totals.total, totals.failed);
+    logMessage(totals.failed == 0 ? LOG_INFO : LOG_WARNING, msg);
+    
+    closeLogSession();
+    if (reader.fd != STDIN_FILENO) {
+        close(reader.fd);
+    }
+    
+    return totals.firstError;
+}
+
+/**
+ * Okunan kaydın satır numarası ve kayıt buffer'ındaki konumları
+ */
+typedef struct {
+    int lineNo;
+    size_t nameOffset;
+    size_t contentOffset;
+    size_t contentLength;
+} PendingRecord;
+
+/**
+ * Kayıt satırlarını toplu olarak dosyalarına ekler
+ */
+ErrorCode runAppendBatch(const char* recordFile) {
+    PendingRecord* pending = NULL;
+    AppendRecord* records = NULL;
+    ErrorCode* results = NULL;
+    char* text = NULL;
+    size_t count = 0;
+    size_t capacity = 0;
+    size_t textSize = 0;
+    size_t textCapacity = 0;
+    ErrorCode firstError = SUCCESS;
+    char msg[MAX_PATH_LENGTH + 200];
+    char* line;
+    int status;
+    int lineNo = 0;
+    int total = 0;
+    int failed = 0;
+    int len;
+    
+    // Kayıt kaynağını aç
+    reader.start = 0;
+    reader.end = 0;
+    reader.eof = 0;
+    if (recordFile == NULL || recordFile[0] == '\0' || strcmp(recordFile, "-") == 0) {
+        reader.fd = STDIN_FILENO;
+    } else {
+        reader.fd = open(recordFile, O_RDONLY);
+        if (reader.fd == -1) {
+            string_format(msg, sizeof(msg), "Kayıt dosyası açılamadı: %s", recordFile);
+            logMessage(LOG_ERROR, msg);
+            return ERROR_FILE_NOT_FOUND;
+        }
+    }
+    
+    openLogSession();
+    long long startTime = monotonicMicros();
+    
+    // Okuyucu buffer'ı yeniden kullanıldığından kayıtlar tek bir buffer'a kopyalanır
+    while ((status = readLine(&reader, &line)) != 0) {
+        lineNo++;
+        
+        if (status == -1) {
+            firstError = ERROR_UNKNOWN;
+            break;
+        }
+        
+        char* tab = (status == 1) ? strchr(line, '\t') : NULL;
+        if (tab == NULL || tab == line) {
+            if (status == 1 && line[0] == '\0') {
+                continue;   // Boş satır
+            }
+            total++;
+            failed++;
+            len = string_format(msg, sizeof(msg), "[%d] HATA: %s\n", lineNo,
+                                (status == -2) ? "satır çok uzun" : "kayıt \"dosya<TAB>içerik\" biçiminde değil");
+            write(STDERR_FILENO, msg, len);
+            firstError = (firstError == SUCCESS) ? ERROR_INVALID_ARGUMENT : firstError;
+            continue;
+        }
+        
+        size_t lineLength = strlen(line) + 1;
+        if (textSize + lineLength > textCapacity) {
+            size_t newCapacity = (textCapacity == 0) ? BATCH_BUFFER_SIZE * 4 : textCapacity * 2;
+            while (newCapacity < textSize + lineLength) {
+                newCapacity *= 2;
+            }
+            char* grown = realloc(text, newCapacity);
+            if (grown == NULL) {
+                firstError = ERROR_UNKNOWN;
+                break;
+            }
+            text = grown;
+            textCapacity = newCapacity;
+        }
+        if (count == capacity) {
+            size_t newCapacity = (capacity == 0) ? 1024 : capacity * 2;
+            PendingRecord* grown = realloc(pending, sizeof(PendingRecord) * newCapacity);
+            if (grown == NULL) {
+                firstError = ERROR_UNKNOWN;
+                break;
+            }
+            pending = grown;
+            capacity = newCapacity;
+        }
+        
+        total++;
+        *tab = '\0';
+        memcpy(text + textSize, line, lineLength);
+        pending[count].lineNo = lineNo;
+        pending[count].nameOffset = textSize;
+        pending[count].contentOffset = textSize + (size_t)(tab - line) + 1;
+        pending[count].contentLength = lineLength - (size_t)(tab - line) - 2;
+        textSize += lineLength;
+        count++;
+    }
+    
+    // Tüm kayıtlar okunduktan sonra dosya başına tek seferde eklenir
+    if (count > 0 && firstError != ERROR_UNKNOWN) {
+        records = malloc(sizeof(AppendRecord) * count);
+        results = malloc(sizeof(ErrorCode) * count);
+        if (records == NULL || results == NULL) {
+            firstError = ERROR_UNKNOWN;
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                records[i].fileName = text + pending[i].nameOffset;
+                records[i].content = text + pending[i].contentOffset;
+                records[i].length = pending[i].contentLength;
+            }
+            
+            ErrorCode result = appendRecords(records, count, results);
+            if (result != SUCCESS && firstError == SUCCESS) {
+                firstError = result;
+            }
+            
+            // batch gibi her kayıt için satır numarasıyla bir durum satırı yazılır
+            for (size_t i = 0; i < count; i++) {
+                if (results[i] == SUCCESS) {
+                    len = string_format(msg, sizeof(msg), "[%d] OK: %s\n", pending[i].lineNo, records[i].fileName);
+                } else {
+                    failed++;
+                    len = string_format(msg, sizeof(msg), "[%d] HATA: %s: %s\n", pending[i].lineNo,
+                                        records[i].fileName, getErrorMessage(results[i]));
+                }
+                write(STDERR_FILENO, msg, len);
+            }
+        }
+    }
+    
+    long long elapsed = monotonicMicros() - startTime;
+    len = string_format(msg, sizeof(msg), "Toplu ekleme özeti: %d kayıt, %d başarılı, %d hatalı, %lld ms\n",
+                        total, total - failed, failed, elapsed / 1000);
+    write(STDERR_FILENO, msg, len);
+    
+    closeLogSession();
+    if (reader.fd != STDIN_FILENO) {
+        close(reader.fd);
+    }
+    
+    free(pending);
+    free(records);
+    free(results);
+    free(text);
+    return firstError;
+}
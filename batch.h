@@ -0,0 +1,53 @@
+/**
+ * batch.h
+ * Toplu (batch) komut çalıştırma için fonksiyon tanımlamaları
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "file_system.h"
+
+#define BATCH_BUFFER_SIZE 65536
+#define MAX_BATCH_ARGS 16
+
+// io_uring arka ucu: tek gönderimdeki en fazla komut ve readFile için okunan en fazla bayt
+#define BATCH_RING_WINDOW 64
+#define BATCH_RING_ENTRIES (BATCH_RING_WINDOW * 4)
+#define BATCH_RING_READ_SIZE 65536
+
+/**
+ * Toplu çalıştırmada komutların yürütülme biçimi
+ */
+typedef enum {
+    BATCH_BACKEND_SYNC,     // Her komut sırayla, bloklayan çağrılarla
+    BATCH_BACKEND_URING     // Bağımsız komutlar io_uring ile tek gönderimde
+} BatchBackend;
+
+/**
+ * Toplu çalıştırmanın arka ucunu ayarlar. io_uring kullanılamıyorsa veya
+ * yalıtım modu açıksa runBatch senkron yürütmeye döner.
+ * 
+ * @param backend Arka uç
+ */
+void setBatchBackend(BatchBackend backend);
+
+/**
+ * Satır satır verilen komutları tek bir işlem içinde sırayla çalıştırır.
+ * Her komutun durumu ve sonunda toplam verim özeti standart hataya yazılır.
+ * 
+ * @param commandFile Komut dosyası (NULL veya boş ise standart girdi)
+ * @return Tüm komutlar başarılıysa SUCCESS, aksi halde ilk hatanın kodu
+ */
+ErrorCode runBatch(const char* commandFile);
+
+/**
+ * "dosya<TAB>içerik" satırlarını okur ve appendRecords ile dosya başına tek
+ * kilit altında ekler. Hatalı kayıtlar ve sonunda özet standart hataya yazılır.
+ * 
+ * @param recordFile Kayıt dosyası (NULL veya boş ise standart girdi)
+ * @return Tüm kayıtlar eklendiyse SUCCESS, aksi halde ilk hatanın kodu
+ */
+ErrorCode runAppendBatch(const char* recordFile);
+
+#endif /* BATCH_H */
@@ -0,0 +1,209 @@
+/**
+ * block_codec.c
+ * Hızlı LZ tabanlı blok sıkıştırma fonksiyonlarının implementasyonları
+ */
+
+#include "block_codec.h"
+#include <stdint.h>
+
+#define CODEC_MAX_OFFSET 65535
+#define CODEC_LAST_LITERALS 5       // Bloğun son baytları her zaman değişmez yazılır
+#define CODEC_SKIP_TRIGGER 6        // Eşleşme bulunamadıkça adım büyür
+
+static uint32_t read32(const unsigned char* p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static uint32_t hashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - CODEC_HASH_BITS);
+}
+
+/**
+ * 15 ve üzeri uzunluğun devamını (255'lik baytlar ve kalan) yazar
+ */
+static unsigned char* writeExtraLength(unsigned char* op, size_t length) {
+    length -= 15;
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = (unsigned char)length;
+    return op;
+}
+
+/**
+ * Bir diziyi (değişmezler + isteğe bağlı eşleşme) yazar
+ * 
+ * @return Yeni yazma konumu, hedefe sığmazsa NULL
+ */
+static unsigned char* writeSequence(unsigned char* op, unsigned char* oend,
+                                    const unsigned char* literals, size_t literalLength,
+                                    size_t offset, size_t matchLength) {
+    size_t needed = 1 + literalLength + literalLength / 255 + 1;
+    if (offset > 0) {
+        needed += 2 + matchLength / 255 + 1;
+    }
+    if ((size_t)(oend - op) < needed) {
+        return NULL;
+    }
+    
+    unsigned char* token = op++;
+    size_t matchCode = (offset > 0) ? matchLength - CODEC_MIN_MATCH : 0;
+    
+    *token = (unsigned char)(((literalLength < 15) ? literalLength : 15) << 4);
+    if (literalLength >= 15) {
+        op = writeExtraLength(op, literalLength);
+    }
+    memcpy(op, literals, literalLength);
+    op += literalLength;
+    
+    if (offset > 0) {
+        *op++ = (unsigned char)(offset & 0xFF);
+        *op++ = (unsigned char)(offset >> 8);
+        *token |= (unsigned char)((matchCode < 15) ? matchCode : 15);
+        if (matchCode >= 15) {
+            op = writeExtraLength(op, matchCode);
+        }
+    }
+    
+    return op;
+}
+
+/**
+ * Bloğu sıkıştırır
+ */
+size_t compressBlock(const char* src, size_t srcLength, char* dst, size_t dstCapacity) {
+    uint32_t table[1 << CODEC_HASH_BITS];
+    const unsigned char* base = (const unsigned char*)src;
+    const unsigned char* ip = base;
+    const unsigned char* anchor = base;
+    const unsigned char* end = base + srcLength;
+    unsigned char* op = (unsigned char*)dst;
+    unsigned char* oend = op + dstCapacity;
+    
+    if (srcLength > CODEC_MIN_MATCH + CODEC_LAST_LITERALS) {
+        const unsigned char* matchLimit = end - CODEC_LAST_LITERALS;
+        unsigned misses = 0;
+        
+        memset(table, 0, sizeof(table));
+        while (ip + CODEC_MIN_MATCH <= matchLimit) {
+            uint32_t sequence = read32(ip);
+            uint32_t hash = hashSequence(sequence);
+            const unsigned char* candidate = base + table[hash];
+            table[hash] = (uint32_t)(ip - base);
+            
+            if (candidate >= ip || (size_t)(ip - candidate) > CODEC_MAX_OFFSET || read32(candidate) != sequence) {
+                // Sıkıştırılamayan veride aramayı seyrekleştir
+                ip += 1 + (misses++ >> CODEC_SKIP_TRIGGER);
+                continue;
+            }
+            misses = 0;
+            
+            // Eşleşmeyi ileri ve geri uzat
+            const unsigned char* matchEnd = ip + CODEC_MIN_MATCH;
+            const unsigned char* ref = candidate + CODEC_MIN_MATCH;
+            while (matchEnd < matchLimit && *matchEnd == *ref) {
+                matchEnd++;
+                ref++;
+            }
+            while (ip > anchor && candidate > base && ip[-1] == candidate[-1]) {
+                ip--;
+                candidate--;
+            }
+            
+            op = writeSequence(op, oend, anchor, (size_t)(ip - anchor),
+                               (size_t)(ip - candidate), (size_t)(matchEnd - ip));
+            if (op == NULL) {
+                return 0;
+            }
+            ip = matchEnd;
+            anchor = ip;
+        }
+    }
+    
+    // Kalan baytlar son dizide değişmez olarak yazılır
+    op = writeSequence(op, oend, anchor, (size_t)(end - anchor), 0, 0);
+    if (op == NULL) {
+        return 0;
+    }
+    
+    return (size_t)(op - (unsigned char*)dst);
+}
+
+/**
+ * Uzunluğun devamını okur
+ * 
+ * @return 0: Başarılı, -1: Veri bitti
+ */
+static int readExtraLength(const unsigned char** ip, const unsigned char* iend, size_t* length) {
+    unsigned char byte;
+    do {
+        if (*ip >= iend) {
+            return -1;
+        }
+        byte = *(*ip)++;
+        *length += byte;
+    } while (byte == 255);
+    return 0;
+}
+
+/**
+ * Sıkıştırılmış bloğu açar
+ */
+ErrorCode decompressBlock(const char* src, size_t srcLength, char* dst, size_t dstLength) {
+    const unsigned char* ip = (const unsigned char*)src;
+    const unsigned char* iend = ip + srcLength;
+    unsigned char* op = (unsigned char*)dst;
+    unsigned char* oend = op + dstLength;
+    
+    while (ip < iend) {
+        unsigned token = *ip++;
+        
+        // Değişmez baytlar
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && readExtraLength(&ip, iend, &literalLength) != 0) {
+            return ERROR_UNKNOWN;
+        }
+        if (literalLength > (size_t)(iend - ip) || literalLength > (size_t)(oend - op)) {
+            return ERROR_UNKNOWN;
+        }
+        memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+        
+        // Son dizide eşleşme yoktur
+        if (ip == iend) {
+            break;
+        }
+        
+        // Eşleşme
+        if (iend - ip < 2) {
+            return ERROR_UNKNOWN;
+        }
+        size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && readExtraLength(&ip, iend, &matchLength) != 0) {
+            return ERROR_UNKNOWN;
+        }
+        matchLength += CODEC_MIN_MATCH;
+        if (offset == 0 || offset > (size_t)(op - (unsigned char*)dst) || matchLength > (size_t)(oend - op)) {
+            return ERROR_UNKNOWN;
+        }
+        
+        const unsigned char* ref = op - offset;
+        if (offset >= matchLength) {
+            memcpy(op, ref, matchLength);
+            op += matchLength;
+        } else {
+            // Örtüşen kopya (tekrarlanan desen)
+            while (matchLength-- > 0) {
+                *op++ = *ref++;
+            }
+        }
+    }
+    
+    return (op == oend) ? SUCCESS : ERROR_UNKNOWN;
+}
@@ -0,0 +1,41 @@
+/**
+ * block_codec.h
+ * Hızlı LZ tabanlı blok sıkıştırma fonksiyonları için tanımlamalar
+ *
+ * Biçim LZ4 blok biçimine benzer: her dizi bir belirteç baytı (üst 4 bit
+ * değişmez uzunluğu, alt 4 bit eşleşme uzunluğu - 4), değişmez baytlar ve
+ * 2 baytlık geri uzaklıktan oluşur. Son dizide uzaklık yoktur.
+ */
+
+#ifndef BLOCK_CODEC_H
+#define BLOCK_CODEC_H
+
+#include "file_system.h"
+
+#define CODEC_BLOCK_SIZE 65536
+#define CODEC_MIN_MATCH 4
+#define CODEC_HASH_BITS 13
+
+/**
+ * Bloğu sıkıştırır
+ * 
+ * @param src Kaynak veri
+ * @param srcLength Kaynak uzunluğu
+ * @param dst Hedef buffer
+ * @param dstCapacity Hedef buffer boyutu
+ * @return Sıkıştırılmış uzunluk, sonuç hedefe sığmazsa 0
+ */
+size_t compressBlock(const char* src, size_t srcLength, char* dst, size_t dstCapacity);
+
+/**
+ * Sıkıştırılmış bloğu açar
+ * 
+ * @param src Sıkıştırılmış veri
+ * @param srcLength Sıkıştırılmış uzunluk
+ * @param dst Hedef buffer
+ * @param dstLength Açılmış verinin beklenen uzunluğu
+ * @return Başarı durumu (bozuk veride ERROR_UNKNOWN)
+ */
+ErrorCode decompressBlock(const char* src, size_t srcLength, char* dst, size_t dstLength);
+
+#endif /* BLOCK_CODEC_H */
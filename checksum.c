@@ -0,0 +1,402 @@
+/**
+ * checksum.c
+ * CRC32C sağlama toplamı hesaplamanın implementasyonları
+ */
+
+#include "checksum.h"
+#include "file_operations.h"
+#include "logger.h"
+#include "utils.h"
+#include "work_pool.h"
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/xattr.h>
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+#define CRC32C_POLY 0x82F63B78      // Castagnoli polinomu (ters bit sırası)
+
+/**
+ * Parça durumu
+ */
+typedef struct {
+    size_t offset;
+    size_t length;
+    uint32_t crc;
+} ChecksumChunk;
+
+static uint32_t crcTable[8][256];
+static uint32_t (*crcFunction)(uint32_t crc, const unsigned char* data, size_t length);
+static pthread_once_t crcOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * Tablo ile CRC32C (8 baytlık dilimler)
+ */
+static uint32_t crc32cTable(uint32_t crc, const unsigned char* data, size_t length) {
+    while (length > 0 && ((uintptr_t)data & 7) != 0) {
+        crc = crcTable[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+        length--;
+    }
+    
+    while (length >= 8) {
+        uint32_t low = crc ^ ((uint32_t)data[0] | (uint32_t)data[1] << 8 | (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24);
+        crc = crcTable[7][low & 0xFF] ^ crcTable[6][(low >> 8) & 0xFF] ^
+              crcTable[5][(low >> 16) & 0xFF] ^ crcTable[4][low >> 24] ^
+              crcTable[3][data[4]] ^ crcTable[2][data[5]] ^
+              crcTable[1][data[6]] ^ crcTable[0][data[7]];
+        data += 8;
+        length -= 8;
+    }
+    
+    while (length > 0) {
+        crc = crcTable[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+        length--;
+    }
+    return crc;
+}
+
+#if defined(__x86_64__)
+/**
+ * SSE4.2 crc32 komutu ile CRC32C
+ */
+__attribute__((target("sse4.2")))
+static uint32_t crc32cHardware(uint32_t crc, const unsigned char* data, size_t length) {
+    uint64_t value = crc;
+    
+    while (length > 0 && ((uintptr_t)data & 7) != 0) {
+        value = _mm_crc32_u8((uint32_t)value, *data++);
+        length--;
+    }
+    
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        value = _mm_crc32_u64(value, word);
+        data += 8;
+        length -= 8;
+    }
+    
+    while (length > 0) {
+        value = _mm_crc32_u8((uint32_t)value, *data++);
+        length--;
+    }
+    return (uint32_t)value;
+}
+#endif
+
+/**
+ * Tabloyu oluşturur ve işlemciye göre hesaplama fonksiyonunu seçer
+ */
+static void initCrc32c() {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+        }
+        crcTable[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int slice = 1; slice < 8; slice++) {
+            crcTable[slice][i] = crcTable[0][crcTable[slice - 1][i] & 0xFF] ^ (crcTable[slice - 1][i] >> 8);
+        }
+    }
+    
+    crcFunction = crc32cTable;
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("sse4.2")) {
+        crcFunction = crc32cHardware;
+    }
+#endif
+}
+
+/**
+ * CRC32C değerini günceller
+ */
+uint32_t crc32cUpdate(uint32_t crc, const void* data, size_t length) {
+    pthread_once(&crcOnce, initCrc32c);
+    return ~crcFunction(~crc, data, length);
+}
+
+/**
+ * GF(2) üzerinde 32x32 matrisi vektörle çarpar
+ */
+static uint32_t gf2MatrixTimes(const uint32_t* matrix, uint32_t vector) {
+    uint32_t sum = 0;
+    
+    while (vector != 0) {
+        if (vector & 1) {
+            sum ^= *matrix;
+        }
+        vector >>= 1;
+        matrix++;
+    }
+    return sum;
+}
+
+/**
+ * GF(2) üzerinde matrisin karesini alır
+ */
+static void gf2MatrixSquare(uint32_t* square, const uint32_t* matrix) {
+    for (int n = 0; n < 32; n++) {
+        square[n] = gf2MatrixTimes(matrix, matrix[n]);
+    }
+}
+
+/**
+ * İki bloğun CRC32C değerlerini birleştirir. İlk değer, ikinci bloğun
+ * uzunluğu kadar sıfır bayt eklenmiş gibi ilerletilir; bunun için
+ * "bir sıfır bit ekle" operatörünün kareleri alınarak log(uzunluk) adımda
+ * hesaplanır.
+ */
+uint32_t crc32cCombine(uint32_t crc1, uint32_t crc2, uint64_t length2) {
+    uint32_t even[32];
+    uint32_t odd[32];
+    
+    if (length2 == 0) {
+        return crc1;
+    }
+    
+    // Tek sıfır bit operatörü
+    odd[0] = CRC32C_POLY;
+    uint32_t row = 1;
+    for (int n = 1; n < 32; n++) {
+        odd[n] = row;
+        row <<= 1;
+    }
+    
+    gf2MatrixSquare(even, odd);     // İki sıfır bit
+    gf2MatrixSquare(odd, even);     // Dört sıfır bit
+    
+    // İlk kare alma bir sıfır bayt (sekiz bit) operatörünü verir
+    do {
+        gf2MatrixSquare(even, odd);
+        if (length2 & 1) {
+            crc1 = gf2MatrixTimes(even, crc1);
+        }
+        length2 >>= 1;
+        if (length2 == 0) {
+            break;
+        }
+        
+        gf2MatrixSquare(odd, even);
+        if (length2 & 1) {
+            crc1 = gf2MatrixTimes(odd, crc1);
+        }
+        length2 >>= 1;
+    } while (length2 != 0);
+    
+    return crc1 ^ crc2;
+}
+
+/**
+ * Önbellek kaydını okur; dosyanın güncel hali için geçerliyse değeri döndürür
+ *
+ * @return 1: Geçerli kayıt bulundu, 0: Bulunamadı
+ */
+static int readChecksumCache(int fd, const struct stat* st, uint32_t* checksum) {
+    ChecksumCacheRecord record;
+    
+    if (fgetxattr(fd, CHECKSUM_CACHE_XATTR, &record, sizeof(record)) != (ssize_t)sizeof(record)) {
+        return 0;
+    }
+    
+    // Hesaplama anına çok yakın değişiklikler aynı zaman damgası içinde
+    // kalmış olabileceğinden böyle bir kayda güvenilmez
+    if (record.magic != CHECKSUM_CACHE_MAGIC || record.version != CHECKSUM_CACHE_VERSION ||
+        record.inode != (uint64_t)st->st_ino ||
+        record.size != (uint64_t)st->st_size ||
+        record.mtimeNs != timespecToNs(&st->st_mtim) ||
+        record.computedNs - record.mtimeNs < CHECKSUM_CACHE_RACY_NS) {
+        return 0;
+    }
+    
+    *checksum = record.checksum;
+    return 1;
+}
+
+/**
+ * Hesaplanan değeri önbelleğe yazar. Dosya sistemi genişletilmiş öznitelikleri
+ * desteklemiyorsa veya dosyaya yazma izni yoksa kayıt tutulmaz.
+ */
+static void writeChecksumCache(int fd, const struct stat* st, int64_t computedNs, uint32_t checksum) {
+    ChecksumCacheRecord record;
+    
+    memset(&record, 0, sizeof(record));
+    record.magic = CHECKSUM_CACHE_MAGIC;
+    record.version = CHECKSUM_CACHE_VERSION;
+    record.inode = (uint64_t)st->st_ino;
+    record.size = (uint64_t)st->st_size;
+    record.mtimeNs = timespecToNs(&st->st_mtim);
+    record.computedNs = computedNs;
+    record.checksum = checksum;
+    
+    fsetxattr(fd, CHECKSUM_CACHE_XATTR, &record, sizeof(record), 0);
+}
+
+/**
+ * Havuz işi: bir parçanın CRC32C değerini hesaplar
+ */
+static void checksumChunkWork(WorkPool* pool, int workerIndex, void* item) {
+    const unsigned char* data = getWorkPoolContext(pool);
+    ChecksumChunk* chunk = item;
+    (void)workerIndex;
+    
+    chunk->crc = crc32cUpdate(0, data + chunk->offset, chunk->length);
+}
+
+/**
+ * Eşlenmiş içeriğin CRC32C değerini parçalar halinde paralel hesaplar
+ */
+static ErrorCode checksumData(const unsigned char* data, size_t size, uint32_t* checksum) {
+    size_t chunkCount = (size + CHECKSUM_CHUNK_SIZE - 1) / CHECKSUM_CHUNK_SIZE;
+    int threads = getDefaultPoolSize();
+    
+    if (chunkCount <= 1 || threads <= 1) {
+        *checksum = crc32cUpdate(0, data, size);
+        return SUCCESS;
+    }
+    if ((size_t)threads > chunkCount) {
+        threads = (int)chunkCount;
+    }
+    
+    ChecksumChunk* chunks = malloc(sizeof(ChecksumChunk) * chunkCount);
+    WorkPool* pool = (chunks != NULL) ? createWorkPool(threads, checksumChunkWork, (void*)data) : NULL;
+    if (pool == NULL) {
+        free(chunks);
+        return ERROR_UNKNOWN;
+    }
+    
+    for (size_t i = 0; i < chunkCount; i++) {
+        chunks[i].offset = i * CHECKSUM_CHUNK_SIZE;
+        chunks[i].length = (size - chunks[i].offset < CHECKSUM_CHUNK_SIZE) ? size - chunks[i].offset : CHECKSUM_CHUNK_SIZE;
+        if (submitWork(pool, -1, &chunks[i]) != SUCCESS) {
+            // Kuyruğa eklenemeyen parça burada hesaplanır
+            chunks[i].crc = crc32cUpdate(0, data + chunks[i].offset, chunks[i].length);
+        }
+    }
+    waitWorkPool(pool);
+    destroyWorkPool(pool);
+    
+    // Parçalar dosyadaki sırayla birleştirilir; sonuç tek geçişle aynıdır
+    uint32_t crc = chunks[0].crc;
+    for (size_t i = 1; i < chunkCount; i++) {
+        crc = crc32cCombine(crc, chunks[i].crc, chunks[i].length);
+    }
+    *checksum = crc;
+    
+    free(chunks);
+    return SUCCESS;
+}
+
+/**
+ * Dosyanın CRC32C değerini hesaplar
+ */
+ErrorCode computeFileChecksum(const char* fileName, int useCache, uint32_t* checksum, int* fromCache) {
+    struct stat st, after;
+    struct timespec started;
+    ErrorCode result = SUCCESS;
+    int cached = 0;
+    
+    int fd = open(fileName, O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        if (errno == EACCES) {
+            return ERROR_PERMISSION_DENIED;
+        }
+        return (errno == ENOENT) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+    }
+    if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    // Paylaşımlı modda okuyanlar gibi paylaşımlı kilitlenir
+    int locked = (getLockMode() == LOCK_MODE_SHARED);
+    if (locked) {
+        result = lockFileRange(fd, F_RDLCK, 0, 0);
+        if (result != SUCCESS) {
+            close(fd);
+            return result;
+        }
+    }
+    
+    if (useCache && readChecksumCache(fd, &st, checksum)) {
+        cached = 1;
+    } else if (st.st_size == 0) {
+        *checksum = 0;
+    } else {
+        clock_gettime(CLOCK_REALTIME, &started);
+        
+        unsigned char* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            result = ERROR_UNKNOWN;
+        } else {
+            madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+            result = checksumData(data, (size_t)st.st_size, checksum);
+            munmap(data, (size_t)st.st_size);
+        }
+        
+        // Okuma sırasında değişen dosyanın değeri kaydedilmez
+        if (result == SUCCESS && useCache && fstat(fd, &after) == 0 &&
+            after.st_size == st.st_size &&
+            timespecToNs(&after.st_mtim) == timespecToNs(&st.st_mtim)) {
+            writeChecksumCache(fd, &st, timespecToNs(&started), *checksum);
+        }
+    }
+    
+    if (locked) {
+        unlockFile(fd);
+    }
+    close(fd);
+    
+    if (fromCache != NULL) {
+        *fromCache = cached;
+    }
+    return result;
+}
+
+/**
+ * Değeri 8 haneli onaltılık metne çevirir
+ */
+static void formatChecksum(uint32_t checksum, char* buffer) {
+    static const char digits[] = "0123456789abcdef";
+    
+    for (int i = 7; i >= 0; i--) {
+        buffer[i] = digits[checksum & 0xF];
+        checksum >>= 4;
+    }
+    buffer[8] = '\0';
+}
+
+/**
+ * Dosyanın CRC32C değerini çıktıya yazar
+ */
+ErrorCode checksumFile(const char* fileName, int useCache) {
+    char logMsg[MAX_PATH_LENGTH + 100];
+    char line[MAX_PATH_LENGTH + 20];
+    char hex[9];
+    uint32_t checksum;
+    int fromCache = 0;
+    
+    ErrorCode result = computeFileChecksum(fileName, useCache, &checksum, &fromCache);
+    
+    if (result == ERROR_FILE_NOT_FOUND) {
+        logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, fileName);
+        return result;
+    } else if (result == ERROR_LOCK_TIMEOUT) {
+        string_format(logMsg, sizeof(logMsg), "%s (%d ms)", fileName, getLockTimeout());
+        logEvent(LOG_ERROR, OP_LOCK_TIMEOUT, logMsg);
+        return result;
+    } else if (result != SUCCESS) {
+        logEvent(LOG_ERROR, OP_CHECKSUM_ERROR, fileName);
+        return result;
+    }
+    
+    formatChecksum(checksum, hex);
+    int len = string_format(line, sizeof(line), "%s  %s\n", hex, fileName);
+    write(getOutputFd(), line, len);
+    
+    string_format(logMsg, sizeof(logMsg), "%s: crc32c %s%s", fileName, hex, fromCache ? " (önbellekten)" : "");
+    logEvent(LOG_INFO, OP_CHECKSUM_COMPUTED, logMsg);
+    return SUCCESS;
+}
@@ -0,0 +1,81 @@
+/**
+ * checksum.h
+ * Dosya içeriği için CRC32C sağlama toplamı fonksiyon tanımlamaları
+ *
+ * Büyük dosyalar parçalara bölünür ve parçalar iş parçacığı havuzunda paralel
+ * hesaplanır. Parça sonuçları sırayla birleştirilir; sonuç, dosyanın tek
+ * geçişte hesaplanan CRC32C değeriyle aynıdır ve parça boyutuna veya iş
+ * parçacığı sayısına bağlı değildir. İşlemci destekliyorsa SSE4.2 crc32
+ * komutu, desteklemiyorsa tablo kullanılır.
+ *
+ * Hesaplanan değer dosyanın genişletilmiş özniteliğinde (xattr) boyut, mtime
+ * ve inode ile birlikte saklanır; bunlar değişmediyse dosya yeniden okunmaz.
+ */
+
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include "file_system.h"
+#include <stdint.h>
+
+#define CHECKSUM_CHUNK_SIZE (8 * 1024 * 1024)           // Paralel hesaplanan parça boyutu
+#define CHECKSUM_CACHE_XATTR "user.file_system.crc32c"
+#define CHECKSUM_CACHE_MAGIC 0x43524343                 // "CRCC"
+#define CHECKSUM_CACHE_VERSION 1
+#define CHECKSUM_CACHE_RACY_NS 1000000000LL             // Bu süreden yeni değişiklikler güvenilmez
+
+/**
+ * Genişletilmiş öznitelikte saklanan önbellek kaydı
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t inode;
+    uint64_t size;
+    int64_t mtimeNs;            // Hesaplanırken dosyanın mtime değeri
+    int64_t computedNs;         // Hesaplama zamanı
+    uint32_t checksum;
+    uint32_t reserved;
+} ChecksumCacheRecord;
+
+/**
+ * CRC32C değerini verilen veriyle günceller
+ *
+ * @param crc Önceki değer (başlangıçta 0)
+ * @param data Veri
+ * @param length Veri uzunluğu
+ * @return Güncellenmiş değer
+ */
+uint32_t crc32cUpdate(uint32_t crc, const void* data, size_t length);
+
+/**
+ * Ardışık iki bloğun CRC32C değerlerini birleştirir
+ *
+ * @param crc1 İlk bloğun değeri
+ * @param crc2 İkinci bloğun değeri
+ * @param length2 İkinci bloğun uzunluğu
+ * @return İki bloğun art arda eklenmiş halinin değeri
+ */
+uint32_t crc32cCombine(uint32_t crc1, uint32_t crc2, uint64_t length2);
+
+/**
+ * Dosyanın CRC32C değerini hesaplar; çıktıya yazmaz ve log kaydı tutmaz
+ *
+ * @param fileName Dosya adı
+ * @param useCache 1: Geçerli önbellek kaydı varsa kullan ve sonucu kaydet
+ * @param checksum Hesaplanan değer
+ * @param fromCache Değer önbellekten mi alındı (NULL olabilir)
+ * @return Başarı durumu
+ */
+ErrorCode computeFileChecksum(const char* fileName, int useCache, uint32_t* checksum, int* fromCache);
+
+/**
+ * Dosyanın CRC32C değerini "değer  dosya" biçiminde çıktıya yazar
+ *
+ * @param fileName Dosya adı
+ * @param useCache 0: Önbelleği yok say ve dosyayı yeniden oku (--no-cache)
+ * @return Başarı durumu
+ */
+ErrorCode checksumFile(const char* fileName, int useCache);
+
+#endif /* CHECKSUM_H */
@@ -0,0 +1,320 @@
+/**
+ * content_search.c
+ * Dosya içeriklerinde paralel metin aramanın implementasyonları
+ */
+
+#define _GNU_SOURCE
+#include "content_search.h"
+#include "dir_walker.h"
+#include "directory_operations.h"
+#include "executor.h"
+#include "logger.h"
+#include "utils.h"
+#include "work_pool.h"
+#include <sys/mman.h>
+#include <sys/uio.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * Arama görevinin argümanları ve durumu
+ */
+typedef struct {
+    const char* dirName;
+    const char* needle;
+    size_t needleLength;
+    int recursive;
+    long long maxSize;
+    int rootFd;                 // Dosyalar köke göre openat ile açılır
+    int outputFd;               // Çağıran iş parçacığının çıktısı (iş parçacıkları kendi çıktısını bilmez)
+    WorkPool* pool;
+    LineBuffer* buffers;        // Havuz iş parçacığı başına
+    SearchStats stats;
+} SearchArgs;
+
+/**
+ * Bellekte metin arar
+ */
+const char* findSubstring(const char* haystack, size_t length, const char* needle, size_t needleLength) {
+    if (needleLength == 0 || needleLength > length) {
+        return NULL;
+    }
+    if (needleLength == 1) {
+        return memchr(haystack, needle[0], length);
+    }
+
+#ifdef __SSE2__
+    // İlk ve son bayt aynı anda tutan konumlar aday olur; metnin geri kalanı
+    // yalnızca adaylarda karşılaştırılır
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needleLength - 1]);
+    size_t lastStart = length - needleLength;   // Eşleşmenin başlayabileceği son konum
+    size_t i = 0;
+    
+    for (; i + 16 <= lastStart + 1; i += 16) {
+        __m128i blockFirst = _mm_loadu_si128((const __m128i*)(haystack + i));
+        __m128i blockLast = _mm_loadu_si128((const __m128i*)(haystack + i + needleLength - 1));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first),
+                                                                  _mm_cmpeq_epi8(blockLast, last)));
+        while (mask != 0) {
+            unsigned bit = (unsigned)__builtin_ctz(mask);
+            if (memcmp(haystack + i + bit + 1, needle + 1, needleLength - 2) == 0) {
+                return haystack + i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+    
+    // 16 bayttan kısa kalan kısım
+    if (i <= lastStart) {
+        return memmem(haystack + i, length - i, needle, needleLength);
+    }
+    return NULL;
+#else
+    return memmem(haystack, length, needle, needleLength);
+#endif
+}
+
+/**
+ * Eşleşen satırı "dosya:satır:konum: satır" biçiminde iş parçacığının buffer'ına ekler
+ */
+static void writeSearchMatch(SearchArgs* args, LineBuffer* buffer, const char* path,
+                             unsigned long line, long long offset, const char* text, size_t textLength) {
+    char position[64];
+    size_t dirLength = strlen(args->dirName);
+    size_t pathLength = strlen(path);
+    
+    if (textLength > 0 && text[textLength - 1] == '\r') {
+        textLength--;
+    }
+    if (textLength > SEARCH_PREVIEW_LENGTH) {
+        textLength = SEARCH_PREVIEW_LENGTH;
+    }
+    size_t positionLength = (size_t)string_format(position, sizeof(position), ":%lu:%lld: ", line, offset);
+    
+    struct iovec iov[6] = {
+        { (void*)args->dirName, dirLength },
+        { "/", 1 },
+        { (void*)path, pathLength },
+        { position, positionLength },
+        { (void*)text, textLength },
+        { "\n", 1 }
+    };
+    
+    appendLineBuffer(buffer, iov, 6);
+}
+
+/**
+ * Eşlenmiş dosya içeriğinde metni arar
+ *
+ * @return Eşleşen satır sayısı
+ */
+static unsigned long scanContent(SearchArgs* args, LineBuffer* buffer, const char* path,
+                                 const char* data, size_t size) {
+    const char* end = data + size;
+    const char* from = data;
+    const char* lineStart = data;
+    const char* match;
+    unsigned long line = 1;
+    unsigned long matches = 0;
+    
+    while ((match = findSubstring(from, (size_t)(end - from), args->needle, args->needleLength)) != NULL) {
+        // Satır numarası yalnızca eşleşmeye kadar sayılır
+        const char* newline;
+        while ((newline = memchr(lineStart, '\n', (size_t)(match - lineStart))) != NULL) {
+            line++;
+            lineStart = newline + 1;
+        }
+        
+        const char* lineEnd = memchr(match, '\n', (size_t)(end - match));
+        if (lineEnd == NULL) {
+            lineEnd = end;
+        }
+        
+        // Uzun satırlarda eşleşmenin çevresi yazılır
+        const char* preview = lineStart;
+        if (lineEnd - lineStart > SEARCH_PREVIEW_LENGTH && match - lineStart > SEARCH_PREVIEW_LENGTH / 2) {
+            preview = match - SEARCH_PREVIEW_LENGTH / 2;
+        }
+        writeSearchMatch(args, buffer, path, line, (long long)(match - data), preview, (size_t)(lineEnd - preview));
+        matches++;
+        
+        // Aynı satırdaki diğer eşleşmeler tekrar yazılmaz
+        if (lineEnd == end) {
+            break;
+        }
+        line++;
+        lineStart = lineEnd + 1;
+        from = lineStart;
+    }
+    
+    return matches;
+}
+
+/**
+ * Havuz işi: tek bir dosyayı tarar
+ */
+static void searchFileWork(WorkPool* pool, int workerIndex, void* item) {
+    SearchArgs* args = getWorkPoolContext(pool);
+    char* path = item;
+    struct stat st;
+    int skipped = 1;
+    unsigned long matches = 0;
+    
+    // Gezgin bağlantıları izlemediğinden dosya bağlantıları da açılmaz
+    int fd = openat(args->rootFd, path, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+    if (fd != -1 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size <= args->maxSize) {
+        skipped = 0;
+        if (st.st_size >= (off_t)args->needleLength) {
+            char* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                skipped = 1;
+            } else {
+                size_t probe = (st.st_size < SEARCH_BINARY_PROBE_SIZE) ? (size_t)st.st_size : SEARCH_BINARY_PROBE_SIZE;
+                madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+                if (memchr(data, '\0', probe) != NULL) {
+                    skipped = 1;    // İkili dosya
+                } else {
+                    matches = scanContent(args, &args->buffers[workerIndex], path, data, (size_t)st.st_size);
+                }
+                munmap(data, (size_t)st.st_size);
+            }
+        }
+    }
+    if (fd != -1) {
+        close(fd);
+    }
+    
+    if (skipped) {
+        __atomic_add_fetch(&args->stats.skipped, 1, __ATOMIC_RELAXED);
+    } else {
+        __atomic_add_fetch(&args->stats.files, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&args->stats.matches, matches, __ATOMIC_RELAXED);
+    }
+    free(path);
+}
+
+/**
+ * Bulunan dosyayı tarama için havuza ekler
+ */
+static int submitSearchFile(SearchArgs* args, const char* path) {
+    char* copy = strdup(path);
+    
+    if (copy == NULL || submitWork(args->pool, -1, copy) != SUCCESS) {
+        free(copy);
+        __atomic_add_fetch(&args->stats.skipped, 1, __ATOMIC_RELAXED);
+    }
+    return 0;
+}
+
+/**
+ * Ağaç gezintisinde bulunan girdiyi işler
+ */
+static int submitTreeEntry(const char* path, int isDir, int workerIndex, void* userData) {
+    (void)workerIndex;
+    return isDir ? 0 : submitSearchFile(userData, path);
+}
+
+/**
+ * Dizin listelemesinde bulunan girdiyi işler
+ */
+static int submitDirEntry(const char* name, int isDir, void* userData) {
+    return isDir ? 0 : submitSearchFile(userData, name);
+}
+
+/**
+ * searchContent görevi: dosyaları tarar ve özeti çıktıya yazar
+ */
+static int searchContentTask(void* arg) {
+    SearchArgs* args = arg;
+    char header[MAX_PATH_LENGTH * 2 + 100];
+    int threads = getDefaultPoolSize();
+    ErrorCode result;
+    int len;
+    
+    args->outputFd = getOutputFd();
+    memset(&args->stats, 0, sizeof(args->stats));
+    
+    args->rootFd = open(args->dirName, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (args->rootFd == -1) {
+        return EXIT_FAILURE;
+    }
+    
+    args->buffers = createLineBuffers(threads, args->outputFd);
+    args->pool = (args->buffers != NULL) ? createWorkPool(threads, searchFileWork, args) : NULL;
+    if (args->pool == NULL) {
+        destroyLineBuffers(args->buffers, threads);
+        close(args->rootFd);
+        return EXIT_FAILURE;
+    }
+    
+    len = string_format(header, sizeof(header), "'%s' içeren satırlar (%s%s):\n---------------------------------------\n",
+                        args->needle, args->dirName, args->recursive ? ", alt dizinlerle" : "");
+    write(args->outputFd, header, len);
+    
+    // Dosyalar bulundukça taranır; gezinti ile tarama birbirini beklemez
+    if (args->recursive) {
+        WalkOptions options = { threads, 0, NULL, NULL };
+        result = walkDirectoryTree(args->dirName, &options, submitTreeEntry, args, NULL);
+    } else {
+        result = listDirEntries(args->dirName, submitDirEntry, args);
+    }
+    
+    waitWorkPool(args->pool);
+    destroyWorkPool(args->pool);
+    destroyLineBuffers(args->buffers, threads);
+    close(args->rootFd);
+    
+    if (result != SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    
+    len = string_format(header, sizeof(header),
+                        "---------------------------------------\n%lu eşleşme, %lu dosya tarandı, %lu dosya atlandı\n",
+                        args->stats.matches, args->stats.files, args->stats.skipped);
+    write(args->outputFd, header, len);
+    
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Dizindeki dosyalarda metin arar
+ */
+ErrorCode searchContent(const char* dirName, const char* needle, int recursive, int maxKb) {
+    SearchArgs args;
+    char logMsg[MAX_PATH_LENGTH * 2 + 100];
+    int status;
+    
+    if (needle == NULL || needle[0] == '\0' || maxKb < 0) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    // Dizinin var olup olmadığını kontrol et
+    if (!fileExists(dirName) || !isDirectory(dirName)) {
+        logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, dirName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    memset(&args, 0, sizeof(args));
+    args.dirName = dirName;
+    args.needle = needle;
+    args.needleLength = strlen(needle);
+    args.recursive = recursive;
+    args.maxSize = (long long)((maxKb > 0) ? maxKb : SEARCH_DEFAULT_MAX_KB) * 1024;
+    
+    // Aramayı çalıştır (yalıtım modunda ayrı işlemde)
+    status = runTask(searchContentTask, &args);
+    
+    if (status == -1) {
+        logEvent(LOG_ERROR, OP_FORK_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    } else if (status == EXIT_SUCCESS) {
+        string_format(logMsg, sizeof(logMsg), "%s, aranan: %s", dirName, needle);
+        logEvent(LOG_INFO, OP_CONTENT_SEARCHED, logMsg);
+        return SUCCESS;
+    } else {
+        logEvent(LOG_ERROR, OP_CONTENT_SEARCH_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    }
+}
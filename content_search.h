@@ -0,0 +1,53 @@
+/**
+ * content_search.h
+ * Dosya içeriklerinde paralel metin arama için fonksiyon tanımlamaları
+ *
+ * Dosyalar iş parçacığı havuzunda paralel taranır. Her dosya belleğe eşlenir
+ * ve aranan metnin ilk ve son baytı 16 baytlık bloklarla (SSE2) aranır; yalnızca
+ * iki baytın da tuttuğu konumlarda metnin tamamı karşılaştırılır.
+ */
+
+#ifndef CONTENT_SEARCH_H
+#define CONTENT_SEARCH_H
+
+#include "file_system.h"
+
+#define SEARCH_DEFAULT_MAX_KB (256 * 1024)  // Bundan büyük dosyalar taranmaz
+#define SEARCH_BINARY_PROBE_SIZE 8192        // İkili dosya kontrolü için bakılan baş kısım
+#define SEARCH_PREVIEW_LENGTH 200            // Eşleşen satırdan yazılan en fazla bayt
+
+/**
+ * Arama sonucu
+ */
+typedef struct {
+    unsigned long matches;      // Eşleşen satır sayısı
+    unsigned long files;        // Taranan dosya sayısı
+    unsigned long skipped;      // İkili, sınırdan büyük veya açılamayan dosya sayısı
+} SearchStats;
+
+/**
+ * Bellekte metin arar
+ *
+ * @param haystack Aranacak veri
+ * @param length Veri uzunluğu
+ * @param needle Aranan metin
+ * @param needleLength Aranan metnin uzunluğu (0'dan büyük)
+ * @return İlk eşleşmenin başı, bulunamazsa NULL
+ */
+const char* findSubstring(const char* haystack, size_t length, const char* needle, size_t needleLength);
+
+/**
+ * Dizindeki dosyalarda metni arar ve eşleşen her satırı
+ * "dosya:satır:konum: satır" biçiminde çıktıya yazar. Sonuçlar bulundukları
+ * sırayla yazılır. İkili dosyalar (başında NUL baytı olanlar) ve sınırdan
+ * büyük dosyalar atlanır; sembolik bağlantılar izlenmez.
+ *
+ * @param dirName Aranacak dizin
+ * @param needle Aranan metin
+ * @param recursive Alt dizinlerde de ara
+ * @param maxKb Taranacak en büyük dosya boyutu (KB, 0: varsayılan)
+ * @return Başarı durumu
+ */
+ErrorCode searchContent(const char* dirName, const char* needle, int recursive, int maxKb);
+
+#endif /* CONTENT_SEARCH_H */
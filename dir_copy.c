@@ -0,0 +1,540 @@
+/**
+ * dir_copy.c
+ * Paralel dizin ağacı kopyalamanın implementasyonları
+ */
+
+#define _GNU_SOURCE
+#include "dir_copy.h"
+#include "dir_walker.h"
+#include "work_pool.h"
+#include <limits.h>
+#include <linux/fs.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
+
+#define COPY_INITIAL_DIRS 256
+
+/**
+ * İzin ve zamanları kopyalama bitince ayarlanacak dizin
+ */
+typedef struct {
+    char* path;                 // Köke göre göreli yol
+    mode_t mode;
+    struct timespec times[2];   // Erişim ve değişiklik zamanı
+} CopyDirEntry;
+
+/**
+ * Kopyalama boyunca paylaşılan durum
+ */
+typedef struct {
+    int sourceFd;               // Kaynak ve hedef kök dizinleri; yollar bunlara göre açılır
+    int destinationFd;
+    WorkPool* pool;
+    size_t chunkSize;
+    char** buffers;             // İş parçacığı başına, yalnızca buffer ile kopyalamada ayrılır
+    
+    // Aynı anda kopyalanan bayt ve bekleyen dosya sınırları
+    pthread_mutex_t lock;
+    pthread_cond_t released;
+    long long available;
+    unsigned long queued;
+    
+    // Hedefte oluşturulan dizinler (lock ile korunur); kopyalama bitene kadar
+    // tutulduğundan bellek dizin sayısıyla artar
+    CopyDirEntry* dirs;
+    size_t dirCount;
+    size_t dirCapacity;
+    
+    // İlerleme bildirimi
+    CopyProgressCallback progress;
+    void* userData;
+    pthread_mutex_t progressLock;
+    pthread_cond_t progressWake;
+    int done;
+    struct timespec start;
+    
+    CopyTreeStats stats;
+} CopyContext;
+
+/**
+ * Başlangıçtan beri geçen süreyi milisaniye olarak döndürür
+ */
+static unsigned long long elapsedSince(const struct timespec* start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)((now.tv_sec - start->tv_sec) * 1000LL + (now.tv_nsec - start->tv_nsec) / 1000000);
+}
+
+/**
+ * Sayaçların o anki değerlerini kopyalar
+ */
+static void snapshotStats(CopyContext* ctx, CopyTreeStats* stats) {
+    stats->files = __atomic_load_n(&ctx->stats.files, __ATOMIC_RELAXED);
+    stats->directories = __atomic_load_n(&ctx->stats.directories, __ATOMIC_RELAXED);
+    stats->links = __atomic_load_n(&ctx->stats.links, __ATOMIC_RELAXED);
+    stats->skipped = __atomic_load_n(&ctx->stats.skipped, __ATOMIC_RELAXED);
+    stats->failures = __atomic_load_n(&ctx->stats.failures, __ATOMIC_RELAXED);
+    stats->reflinked = __atomic_load_n(&ctx->stats.reflinked, __ATOMIC_RELAXED);
+    stats->bytes = __atomic_load_n(&ctx->stats.bytes, __ATOMIC_RELAXED);
+}
+
+/**
+ * İlerleme iş parçacığı: kopyalama bitene kadar belirli aralıklarla bildirir
+ */
+static void* reportProgress(void* arg) {
+    CopyContext* ctx = arg;
+    CopyTreeStats stats;
+    struct timespec deadline;
+    
+    pthread_mutex_lock(&ctx->progressLock);
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    while (!ctx->done) {
+        deadline.tv_sec += COPY_PROGRESS_INTERVAL_MS / 1000;
+        deadline.tv_nsec += (COPY_PROGRESS_INTERVAL_MS % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        
+        while (!ctx->done && pthread_cond_timedwait(&ctx->progressWake, &ctx->progressLock, &deadline) != ETIMEDOUT) {
+        }
+        if (!ctx->done) {
+            snapshotStats(ctx, &stats);
+            ctx->progress(&stats, elapsedSince(&ctx->start), ctx->userData);
+        }
+    }
+    pthread_mutex_unlock(&ctx->progressLock);
+    return NULL;
+}
+
+/**
+ * Kopyalanacak baytlar için sınırdan yer ayırır; yer açılana kadar bekler
+ */
+static void reserveBytes(CopyContext* ctx, long long bytes) {
+    pthread_mutex_lock(&ctx->lock);
+    while (ctx->available < bytes) {
+        pthread_cond_wait(&ctx->released, &ctx->lock);
+    }
+    ctx->available -= bytes;
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+/**
+ * Ayrılan baytları sınıra geri verir
+ */
+static void releaseBytes(CopyContext* ctx, long long bytes) {
+    pthread_mutex_lock(&ctx->lock);
+    ctx->available += bytes;
+    pthread_cond_broadcast(&ctx->released);
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+/**
+ * Dosya kuyruğunda yer açılana kadar bekler; gezinti kopyalamanın çok önüne geçmez
+ */
+static void reserveQueueSlot(CopyContext* ctx) {
+    pthread_mutex_lock(&ctx->lock);
+    while (ctx->queued >= COPY_MAX_QUEUED_FILES) {
+        pthread_cond_wait(&ctx->released, &ctx->lock);
+    }
+    ctx->queued++;
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+/**
+ * Dosya kuyruğundaki yeri bırakır
+ */
+static void releaseQueueSlot(CopyContext* ctx) {
+    pthread_mutex_lock(&ctx->lock);
+    ctx->queued--;
+    pthread_cond_broadcast(&ctx->released);
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+/**
+ * Buffer'ın tamamını verilen konuma yazar
+ */
+static int writeAllAt(int fd, const char* data, size_t length, off_t offset) {
+    while (length > 0) {
+        ssize_t written = pwrite(fd, data, length, offset);
+        if (written == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        data += written;
+        length -= (size_t)written;
+        offset += written;
+    }
+    return 0;
+}
+
+/**
+ * Dosya içeriğini kopyalar: reflink, copy_file_range, buffer
+ *
+ * @return 0: Başarılı, -1: Hata
+ */
+static int copyContents(CopyContext* ctx, int workerIndex, int sourceFd, int fd, off_t size) {
+    off_t offset = 0;
+    int useRange = 1;
+    
+    if (size == 0) {
+        return 0;
+    }
+    
+    // Reflink: bloklar paylaşılır, veri taşınmaz ve sınırdan yer ayrılmaz
+    if (ioctl(fd, FICLONE, sourceFd) == 0) {
+        __atomic_add_fetch(&ctx->stats.reflinked, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&ctx->stats.bytes, (unsigned long long)size, __ATOMIC_RELAXED);
+        return 0;
+    }
+    
+    while (offset < size) {
+        size_t chunk = (size - offset < (off_t)ctx->chunkSize) ? (size_t)(size - offset) : ctx->chunkSize;
+        ssize_t copied = -1;
+        
+        reserveBytes(ctx, (long long)chunk);
+        
+        if (useRange) {
+            loff_t in = offset;
+            loff_t out = offset;
+            do {
+                copied = copy_file_range(sourceFd, &in, fd, &out, chunk, 0);
+            } while (copied == -1 && errno == EINTR);
+            
+            // Dosya sistemi desteklemiyorsa dosyanın geri kalanı buffer ile kopyalanır
+            if (copied == -1 && (errno == EXDEV || errno == EINVAL || errno == ENOSYS || errno == EOPNOTSUPP)) {
+                useRange = 0;
+            }
+        }
+        
+        if (!useRange) {
+            char* buffer = ctx->buffers[workerIndex];
+            if (buffer == NULL) {
+                buffer = ctx->buffers[workerIndex] = malloc(ctx->chunkSize);
+            }
+            if (buffer != NULL) {
+                do {
+                    copied = pread(sourceFd, buffer, chunk, offset);
+                } while (copied == -1 && errno == EINTR);
+                if (copied > 0 && writeAllAt(fd, buffer, (size_t)copied, offset) == -1) {
+                    copied = -1;
+                }
+            }
+        }
+        
+        releaseBytes(ctx, (long long)chunk);
+        
+        if (copied == -1) {
+            return -1;
+        }
+        if (copied == 0) {
+            break;      // Kaynak kopyalanırken kısaltıldı
+        }
+        offset += copied;
+        __atomic_add_fetch(&ctx->stats.bytes, (unsigned long long)copied, __ATOMIC_RELAXED);
+    }
+    
+    return 0;
+}
+
+/**
+ * Havuz işi: tek bir dosyayı kopyalar ve izin/zamanlarını ayarlar
+ */
+static void copyFileWork(WorkPool* pool, int workerIndex, void* item) {
+    CopyContext* ctx = getWorkPoolContext(pool);
+    char* path = item;
+    struct stat st;
+    int failed = 1;
+    
+    int sourceFd = openat(ctx->sourceFd, path, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+    if (sourceFd != -1 && fstat(sourceFd, &st) == 0 && S_ISREG(st.st_mode)) {
+        // Hedef içerik tamamlanana kadar yalnızca sahibine açıktır
+        int fd = openat(ctx->destinationFd, path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, S_IRUSR | S_IWUSR);
+        if (fd != -1) {
+            struct timespec times[2] = { st.st_atim, st.st_mtim };
+            
+            failed = (copyContents(ctx, workerIndex, sourceFd, fd, st.st_size) == -1 ||
+                      fchmod(fd, st.st_mode & 07777) == -1 ||
+                      futimens(fd, times) == -1);
+            if (close(fd) == -1) {
+                failed = 1;
+            }
+            if (failed) {
+                unlinkat(ctx->destinationFd, path, 0);
+            }
+        }
+    }
+    if (sourceFd != -1) {
+        close(sourceFd);
+    }
+    
+    if (failed) {
+        __atomic_add_fetch(&ctx->stats.failures, 1, __ATOMIC_RELAXED);
+    } else {
+        __atomic_add_fetch(&ctx->stats.files, 1, __ATOMIC_RELAXED);
+    }
+    releaseQueueSlot(ctx);
+    free(path);
+}
+
+/**
+ * Hedefte oluşturulan dizini, izin ve zamanları sonradan ayarlanmak üzere kaydeder
+ */
+static int recordDirectory(CopyContext* ctx, const char* path, const struct stat* st) {
+    char* copy = strdup(path);
+    int result = -1;
+    
+    if (copy == NULL) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&ctx->lock);
+    if (ctx->dirCount == ctx->dirCapacity) {
+        size_t capacity = (ctx->dirCapacity == 0) ? COPY_INITIAL_DIRS : ctx->dirCapacity * 2;
+        CopyDirEntry* dirs = realloc(ctx->dirs, sizeof(CopyDirEntry) * capacity);
+        if (dirs != NULL) {
+            ctx->dirs = dirs;
+            ctx->dirCapacity = capacity;
+        }
+    }
+    if (ctx->dirCount < ctx->dirCapacity) {
+        CopyDirEntry* entry = &ctx->dirs[ctx->dirCount++];
+        entry->path = copy;
+        entry->mode = st->st_mode;
+        entry->times[0] = st->st_atim;
+        entry->times[1] = st->st_mtim;
+        result = 0;
+    }
+    pthread_mutex_unlock(&ctx->lock);
+    
+    if (result != 0) {
+        free(copy);
+    }
+    return result;
+}
+
+/**
+ * Sembolik bağlantının kendisini kopyalar
+ */
+static int copyLink(CopyContext* ctx, const char* path, const struct stat* st) {
+    char target[PATH_MAX];
+    struct timespec times[2] = { st->st_atim, st->st_mtim };
+    
+    ssize_t length = readlinkat(ctx->sourceFd, path, target, sizeof(target));
+    if (length == -1 || (size_t)length == sizeof(target)) {
+        return -1;
+    }
+    target[length] = '\0';
+    
+    if (symlinkat(target, ctx->destinationFd, path) == -1) {
+        return -1;
+    }
+    
+    // Bazı dosya sistemleri bağlantı zamanlarını desteklemez; bu hata sayılmaz
+    utimensat(ctx->destinationFd, path, times, AT_SYMLINK_NOFOLLOW);
+    return 0;
+}
+
+/**
+ * Gezintide bulunan girdiyi kopyalar: dizinler ve bağlantılar hemen
+ * oluşturulur, dosyalar kopyalama havuzuna eklenir
+ */
+static int copyTreeEntry(const char* path, int isDir, int workerIndex, void* userData) {
+    CopyContext* ctx = userData;
+    struct stat st;
+    (void)isDir;
+    (void)workerIndex;
+    
+    if (fstatat(ctx->sourceFd, path, &st, AT_SYMLINK_NOFOLLOW) == -1) {
+        __atomic_add_fetch(&ctx->stats.failures, 1, __ATOMIC_RELAXED);
+        return 0;
+    }
+    
+    if (S_ISDIR(st.st_mode)) {
+        // Dizin, içi doldurulabilsin diye önce yalnızca sahibine açık oluşturulur;
+        // gezgin alt girdileri ancak bu çağrı döndükten sonra bulur
+        if (mkdirat(ctx->destinationFd, path, S_IRWXU) == -1 || recordDirectory(ctx, path, &st) != 0) {
+            __atomic_add_fetch(&ctx->stats.failures, 1, __ATOMIC_RELAXED);
+        } else {
+            __atomic_add_fetch(&ctx->stats.directories, 1, __ATOMIC_RELAXED);
+        }
+    } else if (S_ISLNK(st.st_mode)) {
+        if (copyLink(ctx, path, &st) != 0) {
+            __atomic_add_fetch(&ctx->stats.failures, 1, __ATOMIC_RELAXED);
+        } else {
+            __atomic_add_fetch(&ctx->stats.links, 1, __ATOMIC_RELAXED);
+        }
+    } else if (S_ISREG(st.st_mode)) {
+        reserveQueueSlot(ctx);
+        char* copy = strdup(path);
+        if (copy == NULL || submitWork(ctx->pool, -1, copy) != SUCCESS) {
+            free(copy);
+            releaseQueueSlot(ctx);
+            __atomic_add_fetch(&ctx->stats.failures, 1, __ATOMIC_RELAXED);
+        }
+    } else {
+        __atomic_add_fetch(&ctx->stats.skipped, 1, __ATOMIC_RELAXED);
+    }
+    
+    return 0;
+}
+
+/**
+ * Yolları ters sırayla karşılaştırır; alt dizinler üst dizinlerinden önce gelir
+ */
+static int compareCopyDirsReverse(const void* a, const void* b) {
+    return strcmp(((const CopyDirEntry*)b)->path, ((const CopyDirEntry*)a)->path);
+}
+
+/**
+ * Dizinlerin izin ve zamanlarını en alttan başlayarak ayarlar. Dizinlere
+ * yazmak zamanlarını değiştirdiğinden bu adım tüm kopyalamadan sonra yapılır.
+ */
+static void applyDirectoryMetadata(CopyContext* ctx) {
+    qsort(ctx->dirs, ctx->dirCount, sizeof(CopyDirEntry), compareCopyDirsReverse);
+    
+    for (size_t i = 0; i < ctx->dirCount; i++) {
+        CopyDirEntry* entry = &ctx->dirs[i];
+        if (fchmodat(ctx->destinationFd, entry->path, entry->mode & 07777, 0) == -1 ||
+            utimensat(ctx->destinationFd, entry->path, entry->times, 0) == -1) {
+            ctx->stats.failures++;
+        }
+        free(entry->path);
+    }
+    free(ctx->dirs);
+}
+
+/**
+ * Hedefin kaynağın içinde olup olmadığını kontrol eder (kopya kendi içine kopyalanmasın)
+ */
+static int isInsideSource(const char* source, const char* destination) {
+    char* sourcePath = realpath(source, NULL);
+    char* destinationPath = realpath(destination, NULL);
+    int inside = 1;
+    
+    if (sourcePath != NULL && destinationPath != NULL) {
+        size_t length = strlen(sourcePath);
+        inside = (strncmp(sourcePath, destinationPath, length) == 0 &&
+                  (destinationPath[length] == '/' || (length == 1 && sourcePath[0] == '/')));
+    }
+    
+    free(sourcePath);
+    free(destinationPath);
+    return inside;
+}
+
+/**
+ * Dizin ağacını paralel kopyalar
+ */
+ErrorCode copyDirectoryTree(const char* source, const char* destination, int threads, long long maxInFlight,
+                            CopyProgressCallback progress, void* userData, CopyTreeStats* stats) {
+    CopyContext ctx;
+    struct stat st;
+    pthread_t progressThread;
+    pthread_condattr_t condAttr;
+    int progressStarted = 0;
+    ErrorCode result;
+    
+    if (source == NULL || destination == NULL || maxInFlight < 0) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    memset(&ctx, 0, sizeof(ctx));
+    threads = (threads > 0) ? threads : getDefaultPoolSize();
+    ctx.available = (maxInFlight > 0) ? maxInFlight : COPY_DEFAULT_MAX_IN_FLIGHT;
+    ctx.chunkSize = (ctx.available < COPY_CHUNK_SIZE) ? (size_t)ctx.available : COPY_CHUNK_SIZE;
+    ctx.progress = progress;
+    ctx.userData = userData;
+    
+    // Kök dizinler burada açılır ki hata çağırana dönebilsin
+    ctx.sourceFd = open(source, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (ctx.sourceFd == -1 || fstat(ctx.sourceFd, &st) == -1) {
+        result = (errno == EACCES) ? ERROR_PERMISSION_DENIED :
+                 (errno == ENOENT || errno == ENOTDIR) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+        if (ctx.sourceFd != -1) {
+            close(ctx.sourceFd);
+        }
+        return result;
+    }
+    
+    if (mkdir(destination, S_IRWXU) == -1) {
+        result = (errno == EEXIST) ? ERROR_FILE_EXISTS :
+                 (errno == EACCES) ? ERROR_PERMISSION_DENIED : ERROR_UNKNOWN;
+        close(ctx.sourceFd);
+        return result;
+    }
+    if (isInsideSource(source, destination)) {
+        rmdir(destination);
+        close(ctx.sourceFd);
+        return ERROR_INVALID_ARGUMENT;
+    }
+    ctx.destinationFd = open(destination, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+    if (ctx.destinationFd == -1) {
+        rmdir(destination);
+        close(ctx.sourceFd);
+        return ERROR_UNKNOWN;
+    }
+    ctx.stats.directories = 1;
+    
+    pthread_mutex_init(&ctx.lock, NULL);
+    pthread_cond_init(&ctx.released, NULL);
+    pthread_mutex_init(&ctx.progressLock, NULL);
+    pthread_condattr_init(&condAttr);
+    pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+    pthread_cond_init(&ctx.progressWake, &condAttr);
+    pthread_condattr_destroy(&condAttr);
+    clock_gettime(CLOCK_MONOTONIC, &ctx.start);
+    
+    ctx.buffers = calloc((size_t)threads, sizeof(char*));
+    ctx.pool = (ctx.buffers != NULL) ? createWorkPool(threads, copyFileWork, &ctx) : NULL;
+    if (ctx.pool == NULL) {
+        result = ERROR_UNKNOWN;
+    } else {
+        if (progress != NULL) {
+            progressStarted = (pthread_create(&progressThread, NULL, reportProgress, &ctx) == 0);
+        }
+        
+        // Dosyalar bulundukça kopyalanır; gezinti ile kopyalama birbirini beklemez
+        WalkOptions options = { threads, 0, NULL, NULL };
+        WalkStats walkStats;
+        result = walkDirectoryTree(source, &options, copyTreeEntry, &ctx, &walkStats);
+        ctx.stats.failures += walkStats.unreadable;
+        
+        waitWorkPool(ctx.pool);
+        destroyWorkPool(ctx.pool);
+        
+        if (progressStarted) {
+            pthread_mutex_lock(&ctx.progressLock);
+            ctx.done = 1;
+            pthread_cond_signal(&ctx.progressWake);
+            pthread_mutex_unlock(&ctx.progressLock);
+            pthread_join(progressThread, NULL);
+        }
+        
+        for (int i = 0; i < threads; i++) {
+            free(ctx.buffers[i]);
+        }
+    }
+    free(ctx.buffers);
+    
+    // Alt dizinler, ardından kök
+    applyDirectoryMetadata(&ctx);
+    struct timespec times[2] = { st.st_atim, st.st_mtim };
+    if (fchmod(ctx.destinationFd, st.st_mode & 07777) == -1 || futimens(ctx.destinationFd, times) == -1) {
+        ctx.stats.failures++;
+    }
+    
+    close(ctx.destinationFd);
+    close(ctx.sourceFd);
+    pthread_cond_destroy(&ctx.progressWake);
+    pthread_mutex_destroy(&ctx.progressLock);
+    pthread_cond_destroy(&ctx.released);
+    pthread_mutex_destroy(&ctx.lock);
+    
+    if (stats != NULL) {
+        *stats = ctx.stats;
+    }
+    return result;
+}
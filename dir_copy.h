@@ -0,0 +1,65 @@
+/**
+ * dir_copy.h
+ * Paralel dizin ağacı kopyalama için fonksiyon tanımlamaları
+ *
+ * Kaynak ağaç paralel gezilir; dizinler bulundukça hedefte mkdirat ile
+ * oluşturulur, dosyalar ayrı bir iş parçacığı havuzunda kopyalanır. Her dosya
+ * için önce reflink (FICLONE), ardından copy_file_range, en son buffer ile
+ * kopyalama denenir. Aynı anda kopyalanan bayt miktarı ve kopyalanmayı bekleyen
+ * dosya sayısı sınırlıdır; böylece dosya verisi için kullanılan bellek ağacın
+ * boyutundan bağımsızdır. Dizinlerin izin ve zamanları sonda ayarlanmak üzere
+ * her dizin için bir kayıt tutulur; bu kayıtlar dizin sayısıyla doğrusal artar.
+ */
+
+#ifndef DIR_COPY_H
+#define DIR_COPY_H
+
+#include "file_system.h"
+
+#define COPY_CHUNK_SIZE (8 * 1024 * 1024)               // Tek seferde kopyalanan en büyük parça
+#define COPY_DEFAULT_MAX_IN_FLIGHT (64 * 1024 * 1024)   // Varsayılan eşzamanlı kopyalanan bayt sınırı
+#define COPY_MAX_QUEUED_FILES 4096                      // Kopyalanmayı bekleyen en fazla dosya
+#define COPY_PROGRESS_INTERVAL_MS 1000
+
+/**
+ * Ağaç kopyalama sonucu
+ */
+typedef struct {
+    unsigned long files;        // Kopyalanan dosya sayısı
+    unsigned long directories;  // Oluşturulan dizin sayısı (kök dahil)
+    unsigned long links;        // Kopyalanan sembolik bağlantı sayısı
+    unsigned long skipped;      // Kopyalanmayan özel dosya (FIFO, soket, aygıt) sayısı
+    unsigned long failures;     // Kopyalanamayan girdi sayısı
+    unsigned long reflinked;    // Reflink ile kopyalanan dosya sayısı
+    unsigned long long bytes;   // Kopyalanan bayt sayısı
+} CopyTreeStats;
+
+/**
+ * Kopyalama sürerken belirli aralıklarla çağrılan fonksiyon
+ *
+ * @param stats O ana kadarki sayaçlar
+ * @param elapsedMs Başlangıçtan beri geçen süre
+ * @param userData Kullanıcı verisi
+ */
+typedef void (*CopyProgressCallback)(const CopyTreeStats* stats, unsigned long long elapsedMs, void* userData);
+
+/**
+ * Dizin ağacını paralel kopyalar. Hedef mevcut olmamalıdır. Dosyaların,
+ * dizinlerin ve bağlantıların izinleri ve erişim/değişiklik zamanları korunur;
+ * dizinlerin izin ve zamanları tüm içerik kopyalandıktan sonra ayarlanır.
+ * Sembolik bağlantılar izlenmez, bağlantının kendisi kopyalanır.
+ *
+ * @param source Kaynak dizin
+ * @param destination Oluşturulacak hedef dizin (kaynağın içinde olamaz)
+ * @param threads Kopyalama iş parçacığı sayısı (0: varsayılan)
+ * @param maxInFlight Aynı anda kopyalanan en fazla bayt (0: varsayılan)
+ * @param progress COPY_PROGRESS_INTERVAL_MS aralıklarla çağrılacak fonksiyon (NULL olabilir)
+ * @param userData Geri çağırma fonksiyonuna iletilecek veri
+ * @param stats Sonuç sayaçları (NULL olabilir)
+ * @return Başarı durumu (yalnızca kök dizinler açılamaz/oluşturulamazsa hata;
+ *         kopyalanamayan girdiler stats->failures'ta)
+ */
+ErrorCode copyDirectoryTree(const char* source, const char* destination, int threads, long long maxInFlight,
+                            CopyProgressCallback progress, void* userData, CopyTreeStats* stats);
+
+#endif /* DIR_COPY_H */
@@ -0,0 +1,559 @@
+/**
+ * dir_walker.c
+ * Paralel dizin ağacı gezgininin implementasyonları
+ */
+
+#include "dir_walker.h"
+#include "directory_operations.h"
+#include "work_pool.h"
+
+#define WALK_ARENA_BLOCK_SIZE (1024 * 1024)
+#define WALK_INITIAL_ENTRIES 4096
+
+/**
+ * Gezilen dizin. Alt dizinler bu dizinin tanımlayıcısına göre açıldığından
+ * dizin, kendisine başvuran tüm alt dizinler açılana kadar açık tutulur.
+ */
+typedef struct WalkDir {
+    struct WalkDir* parent;     // Bu dizin açılana kadar tutulan üst dizin
+    DIR* dir;
+    int refs;                   // İşleme + henüz açılmamış alt dizinler
+    size_t nameOffset;          // path içinde son bileşenin başı
+    char path[];                // Köke göre göreli yol (kökte "")
+} WalkDir;
+
+/**
+ * Sıralı modda toplanan girdi
+ */
+typedef struct {
+    const char* path;
+    int isDir;
+} WalkEntry;
+
+/**
+ * Sıralı modda yolların kopyalandığı bellek bloğu
+ */
+typedef struct WalkArenaBlock {
+    struct WalkArenaBlock* next;
+    size_t used;
+    size_t size;
+    char data[];
+} WalkArenaBlock;
+
+/**
+ * İş parçacığına ait durum
+ */
+typedef struct {
+    WalkEntry* entries;
+    size_t count;
+    size_t capacity;
+    WalkArenaBlock* arena;
+    char* scratch;              // Yol oluşturma buffer'ı
+    size_t scratchSize;
+    char padding[64];           // Komşu iş parçacıklarıyla önbellek satırı paylaşımını önler
+} WalkWorker;
+
+/**
+ * Gezinti boyunca paylaşılan durum
+ */
+typedef struct {
+    WalkOptions options;
+    WalkEntryCallback callback;
+    void* userData;
+    WalkWorker* workers;
+    int stop;
+    unsigned long directories;
+    unsigned long entries;
+    unsigned long unreadable;
+} WalkContext;
+
+/**
+ * Alt dizin düğümü oluşturur ve üst dizine başvuru ekler
+ */
+static WalkDir* createWalkDir(WalkDir* parent, const char* path, size_t length, size_t nameOffset) {
+    WalkDir* node = malloc(sizeof(WalkDir) + length + 1);
+    if (node == NULL) {
+        return NULL;
+    }
+    
+    node->parent = parent;
+    node->dir = NULL;
+    node->refs = 1;
+    node->nameOffset = nameOffset;
+    memcpy(node->path, path, length);
+    node->path[length] = '\0';
+    
+    if (parent != NULL) {
+        __atomic_add_fetch(&parent->refs, 1, __ATOMIC_RELAXED);
+    }
+    return node;
+}
+
+/**
+ * Düğüme olan başvuruyu bırakır; son başvuruda dizini kapatır
+ */
+static void releaseWalkDir(WalkDir* node) {
+    if (node != NULL && __atomic_sub_fetch(&node->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        if (node->dir != NULL) {
+            closedir(node->dir);
+        }
+        free(node);
+    }
+}
+
+/**
+ * İş parçacığının yol buffer'ını gereken boyuta büyütür
+ */
+static char* reserveScratch(WalkWorker* worker, size_t size) {
+    if (worker->scratchSize < size) {
+        size_t newSize = (size < 4096) ? 4096 : size * 2;
+        char* scratch = realloc(worker->scratch, newSize);
+        if (scratch == NULL) {
+            return NULL;
+        }
+        worker->scratch = scratch;
+        worker->scratchSize = newSize;
+    }
+    return worker->scratch;
+}
+
+/**
+ * Sıralı mod için girdiyi iş parçacığının listesine kopyalar
+ */
+static int collectEntry(WalkWorker* worker, const char* path, size_t length, int isDir) {
+    WalkArenaBlock* block = worker->arena;
+    
+    if (block == NULL || block->size - block->used < length + 1) {
+        size_t size = (length + 1 > WALK_ARENA_BLOCK_SIZE) ? length + 1 : WALK_ARENA_BLOCK_SIZE;
+        block = malloc(sizeof(WalkArenaBlock) + size);
+        if (block == NULL) {
+            return -1;
+        }
+        block->next = worker->arena;
+        block->used = 0;
+        block->size = size;
+        worker->arena = block;
+    }
+    
+    if (worker->count == worker->capacity) {
+        size_t capacity = (worker->capacity == 0) ? WALK_INITIAL_ENTRIES : worker->capacity * 2;
+        WalkEntry* entries = realloc(worker->entries, sizeof(WalkEntry) * capacity);
+        if (entries == NULL) {
+            return -1;
+        }
+        worker->entries = entries;
+        worker->capacity = capacity;
+    }
+    
+    char* copy = block->data + block->used;
+    memcpy(copy, path, length + 1);
+    block->used += length + 1;
+    
+    worker->entries[worker->count].path = copy;
+    worker->entries[worker->count].isDir = isDir;
+    worker->count++;
+    return 0;
+}
+
+/**
+ * Havuz işi: bir dizini okur, girdileri iletir ve alt dizinleri kuyruğa ekler
+ */
+static void walkDirectory(WorkPool* pool, int workerIndex, void* item) {
+    WalkContext* ctx = getWorkPoolContext(pool);
+    WalkWorker* worker = &ctx->workers[workerIndex];
+    WalkDir* node = item;
+    struct dirent* entry;
+    
+    // Kök dışındaki dizinler üst dizine göre açılır; bağlantılar izlenmez
+    if (node->dir == NULL) {
+        int fd = -1;
+        if (!__atomic_load_n(&ctx->stop, __ATOMIC_RELAXED)) {
+            fd = openat(dirfd(node->parent->dir), node->path + node->nameOffset,
+                        O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+        }
+        if (fd != -1) {
+            node->dir = fdopendir(fd);
+            if (node->dir == NULL) {
+                close(fd);
+            }
+        }
+        releaseWalkDir(node->parent);
+        node->parent = NULL;
+        
+        if (node->dir == NULL) {
+            if (!__atomic_load_n(&ctx->stop, __ATOMIC_RELAXED)) {
+                __atomic_add_fetch(&ctx->unreadable, 1, __ATOMIC_RELAXED);
+            }
+            releaseWalkDir(node);
+            return;
+        }
+    }
+    
+    __atomic_add_fetch(&ctx->directories, 1, __ATOMIC_RELAXED);
+    size_t baseLength = strlen(node->path);
+    
+    while (!__atomic_load_n(&ctx->stop, __ATOMIC_RELAXED) && (entry = readdir(node->dir)) != NULL) {
+        // "." ve ".." öğelerini atla
+        if (entry->d_name[0] == '.' &&
+            (entry->d_name[1] == '\0' || (entry->d_name[1] == '.' && entry->d_name[2] == '\0'))) {
+            continue;
+        }
+        
+        int isDir;
+        int descend = classifyDirEntry(dirfd(node->dir), entry, &isDir);
+        
+        // Göreli yol: "<üst>/<ad>" (kökte yalnızca ad)
+        size_t nameLength = strlen(entry->d_name);
+        size_t nameOffset = (baseLength > 0) ? baseLength + 1 : 0;
+        size_t length = nameOffset + nameLength;
+        char* path = reserveScratch(worker, length + 1);
+        if (path == NULL) {
+            __atomic_store_n(&ctx->stop, 1, __ATOMIC_RELAXED);
+            break;
+        }
+        if (baseLength > 0) {
+            memcpy(path, node->path, baseLength);
+            path[baseLength] = '/';
+        }
+        memcpy(path + nameOffset, entry->d_name, nameLength + 1);
+        
+        if (ctx->options.filter == NULL || ctx->options.filter(entry->d_name, isDir, ctx->options.filterData)) {
+            if (ctx->options.ordered) {
+                if (collectEntry(worker, path, length, isDir) != 0) {
+                    __atomic_store_n(&ctx->stop, 1, __ATOMIC_RELAXED);
+                }
+            } else if (ctx->callback(path, isDir, workerIndex, ctx->userData) != 0) {
+                __atomic_store_n(&ctx->stop, 1, __ATOMIC_RELAXED);
+            } else {
+                __atomic_add_fetch(&ctx->entries, 1, __ATOMIC_RELAXED);
+            }
+        }
+        
+        if (descend) {
+            WalkDir* child = createWalkDir(node, path, length, nameOffset);
+            if (child == NULL) {
+                __atomic_add_fetch(&ctx->unreadable, 1, __ATOMIC_RELAXED);
+            } else if (submitWork(pool, workerIndex, child) != SUCCESS) {
+                __atomic_add_fetch(&ctx->unreadable, 1, __ATOMIC_RELAXED);
+                releaseWalkDir(node);
+                free(child);
+            }
+        }
+    }
+    
+    releaseWalkDir(node);
+}
+
+/**
+ * Yolları dizin ağacı sırasıyla karşılaştırır ('/' diğer tüm karakterlerden önce gelir)
+ */
+static int compareWalkEntries(const void* a, const void* b) {
+    const unsigned char* p = (const unsigned char*)((const WalkEntry*)a)->path;
+    const unsigned char* q = (const unsigned char*)((const WalkEntry*)b)->path;
+    
+    while (*p != '\0' && *p == *q) {
+        p++;
+        q++;
+    }
+    
+    int cp = (*p == '/') ? 1 : *p;
+    int cq = (*q == '/') ? 1 : *q;
+    return cp - cq;
+}
+
+/**
+ * Sıralı modda toplanan girdileri sıralayıp iletir
+ */
+static ErrorCode deliverOrdered(WalkContext* ctx, int workerCount) {
+    size_t total = 0;
+    size_t offset = 0;
+    
+    for (int i = 0; i < workerCount; i++) {
+        total += ctx->workers[i].count;
+    }
+    if (total == 0) {
+        return SUCCESS;
+    }
+    
+    WalkEntry* all = malloc(sizeof(WalkEntry) * total);
+    if (all == NULL) {
+        return ERROR_UNKNOWN;
+    }
+    for (int i = 0; i < workerCount; i++) {
+        memcpy(all + offset, ctx->workers[i].entries, sizeof(WalkEntry) * ctx->workers[i].count);
+        offset += ctx->workers[i].count;
+    }
+    
+    qsort(all, total, sizeof(WalkEntry), compareWalkEntries);
+    
+    for (size_t i = 0; i < total; i++) {
+        if (ctx->callback(all[i].path, all[i].isDir, 0, ctx->userData) != 0) {
+            break;
+        }
+        ctx->entries++;
+    }
+    
+    free(all);
+    return SUCCESS;
+}
+
+/**
+ * Dizin ağacını paralel gezer
+ */
+ErrorCode walkDirectoryTree(const char* root, const WalkOptions* options,
+                            WalkEntryCallback callback, void* userData, WalkStats* stats) {
+    static const WalkOptions defaults = { 0, 0, NULL, NULL };
+    WalkContext ctx;
+    ErrorCode result = SUCCESS;
+    WorkPool* pool;
+    
+    // Erken dönülse de çağıran sayaçları okuyabilir
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(*stats));
+    }
+    
+    if (root == NULL || callback == NULL) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.options = (options != NULL) ? *options : defaults;
+    ctx.callback = callback;
+    ctx.userData = userData;
+    
+    // Kök dizin burada açılır ki hata çağırana dönebilsin
+    DIR* rootDir = opendir(root);
+    if (rootDir == NULL) {
+        if (errno == EACCES) {
+            return ERROR_PERMISSION_DENIED;
+        }
+        return (errno == ENOENT || errno == ENOTDIR) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+    }
+    
+    WalkDir* rootNode = createWalkDir(NULL, "", 0, 0);
+    if (rootNode == NULL) {
+        closedir(rootDir);
+        return ERROR_UNKNOWN;
+    }
+    rootNode->dir = rootDir;
+    
+    int threads = (ctx.options.threads > 0) ? ctx.options.threads : getDefaultPoolSize();
+    ctx.workers = calloc((size_t)threads, sizeof(WalkWorker));
+    pool = (ctx.workers != NULL) ? createWorkPool(threads, walkDirectory, &ctx) : NULL;
+    if (pool == NULL || submitWork(pool, -1, rootNode) != SUCCESS) {
+        destroyWorkPool(pool);
+        free(ctx.workers);
+        releaseWalkDir(rootNode);
+        return ERROR_UNKNOWN;
+    }
+    
+    waitWorkPool(pool);
+    int workerCount = getWorkPoolSize(pool);
+    destroyWorkPool(pool);
+    
+    if (ctx.options.ordered) {
+        result = deliverOrdered(&ctx, workerCount);
+    }
+    
+    // İş parçacığı durumlarını serbest bırak
+    for (int i = 0; i < threads; i++) {
+        WalkArenaBlock* block = ctx.workers[i].arena;
+        while (block != NULL) {
+            WalkArenaBlock* next = block->next;
+            free(block);
+            block = next;
+        }
+        free(ctx.workers[i].entries);
+        free(ctx.workers[i].scratch);
+    }
+    free(ctx.workers);
+    
+    if (stats != NULL) {
+        stats->directories = ctx.directories;
+        stats->entries = ctx.entries;
+        stats->unreadable = ctx.unreadable;
+    }
+    return result;
+}
+
+/**
+ * Silinen dizin. Alt dizinler bu dizinin tanımlayıcısına göre açılıp
+ * silindiğinden dizin, tüm alt dizinleri silinene kadar açık tutulur.
+ */
+typedef struct RemoveDir {
+    struct RemoveDir* parent;
+    int fd;                     // -1: henüz açılmadı
+    int pending;                // İşleme + silinmemiş alt dizinler
+    int failed;                 // Alt ağaçta silinemeyen girdi var
+    char name[];                // Üst dizine göre ad (kökte verilen yol)
+} RemoveDir;
+
+/**
+ * Silme boyunca paylaşılan sayaçlar
+ */
+typedef struct {
+    unsigned long files;
+    unsigned long directories;
+    unsigned long failures;
+} RemoveContext;
+
+/**
+ * Silinecek alt dizin düğümü oluşturur ve üst dizinin bekleme sayısını artırır
+ */
+static RemoveDir* createRemoveDir(RemoveDir* parent, const char* name, size_t length) {
+    RemoveDir* node = malloc(sizeof(RemoveDir) + length + 1);
+    if (node == NULL) {
+        return NULL;
+    }
+    
+    node->parent = parent;
+    node->fd = -1;
+    node->pending = 1;
+    node->failed = 0;
+    memcpy(node->name, name, length);
+    node->name[length] = '\0';
+    
+    if (parent != NULL) {
+        __atomic_add_fetch(&parent->pending, 1, __ATOMIC_RELAXED);
+    }
+    return node;
+}
+
+/**
+ * Düğümün bir beklemesini bitirir; kalmadıysa dizini siler ve üst dizine geçer
+ */
+static void finishRemoveDir(RemoveContext* ctx, RemoveDir* node) {
+    while (node != NULL && __atomic_sub_fetch(&node->pending, 1, __ATOMIC_ACQ_REL) == 0) {
+        RemoveDir* parent = node->parent;
+        int parentFd = (parent != NULL) ? parent->fd : AT_FDCWD;
+        
+        if (node->fd != -1) {
+            close(node->fd);
+        }
+        
+        if (!__atomic_load_n(&node->failed, __ATOMIC_RELAXED) &&
+            unlinkat(parentFd, node->name, AT_REMOVEDIR) == 0) {
+            __atomic_add_fetch(&ctx->directories, 1, __ATOMIC_RELAXED);
+        } else {
+            __atomic_add_fetch(&ctx->failures, 1, __ATOMIC_RELAXED);
+            if (parent != NULL) {
+                __atomic_store_n(&parent->failed, 1, __ATOMIC_RELAXED);
+            }
+        }
+        
+        free(node);
+        node = parent;
+    }
+}
+
+/**
+ * Havuz işi: bir dizindeki dosyaları siler ve alt dizinleri kuyruğa ekler
+ */
+static void removeDirectory(WorkPool* pool, int workerIndex, void* item) {
+    RemoveContext* ctx = getWorkPoolContext(pool);
+    RemoveDir* node = item;
+    struct dirent* entry;
+    DIR* dir = NULL;
+    
+    // Kök dışındaki dizinler üst dizine göre açılır; bağlantılar izlenmez
+    if (node->fd == -1) {
+        node->fd = openat(node->parent->fd, node->name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+    }
+    
+    // Okuma akışı kendi tanımlayıcısını kapatacağından kopyası kullanılır
+    if (node->fd != -1) {
+        int readFd = fcntl(node->fd, F_DUPFD_CLOEXEC, 0);
+        dir = (readFd != -1) ? fdopendir(readFd) : NULL;
+        if (dir == NULL && readFd != -1) {
+            close(readFd);
+        }
+    }
+    if (dir == NULL) {
+        __atomic_store_n(&node->failed, 1, __ATOMIC_RELAXED);
+        finishRemoveDir(ctx, node);
+        return;
+    }
+    
+    while ((entry = readdir(dir)) != NULL) {
+        // "." ve ".." öğelerini atla
+        if (entry->d_name[0] == '.' &&
+            (entry->d_name[1] == '\0' || (entry->d_name[1] == '.' && entry->d_name[2] == '\0'))) {
+            continue;
+        }
+        
+        int isDir;
+        if (classifyDirEntry(node->fd, entry, &isDir)) {
+            RemoveDir* child = createRemoveDir(node, entry->d_name, strlen(entry->d_name));
+            if (child == NULL) {
+                __atomic_add_fetch(&ctx->failures, 1, __ATOMIC_RELAXED);
+                __atomic_store_n(&node->failed, 1, __ATOMIC_RELAXED);
+            } else if (submitWork(pool, workerIndex, child) != SUCCESS) {
+                __atomic_add_fetch(&ctx->failures, 1, __ATOMIC_RELAXED);
+                __atomic_store_n(&node->failed, 1, __ATOMIC_RELAXED);
+                __atomic_sub_fetch(&node->pending, 1, __ATOMIC_RELAXED);
+                free(child);
+            }
+        } else if (unlinkat(node->fd, entry->d_name, 0) == 0) {
+            __atomic_add_fetch(&ctx->files, 1, __ATOMIC_RELAXED);
+        } else {
+            __atomic_add_fetch(&ctx->failures, 1, __ATOMIC_RELAXED);
+            __atomic_store_n(&node->failed, 1, __ATOMIC_RELAXED);
+        }
+    }
+    
+    closedir(dir);
+    finishRemoveDir(ctx, node);
+}
+
+/**
+ * Dizin ağacını aşağıdan yukarıya paralel siler
+ */
+ErrorCode removeDirectoryTree(const char* root, int threads, RemoveStats* stats) {
+    RemoveContext ctx;
+    WorkPool* pool;
+    
+    // Erken dönülse de çağıran sayaçları okuyabilir
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(*stats));
+    }
+    
+    if (root == NULL) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    memset(&ctx, 0, sizeof(ctx));
+    
+    // Kök dizin burada açılır ki hata çağırana dönebilsin
+    int rootFd = open(root, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+    if (rootFd == -1) {
+        if (errno == EACCES) {
+            return ERROR_PERMISSION_DENIED;
+        }
+        return (errno == ENOENT || errno == ENOTDIR || errno == ELOOP) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+    }
+    
+    RemoveDir* rootNode = createRemoveDir(NULL, root, strlen(root));
+    if (rootNode == NULL) {
+        close(rootFd);
+        return ERROR_UNKNOWN;
+    }
+    rootNode->fd = rootFd;
+    
+    pool = createWorkPool((threads > 0) ? threads : getDefaultPoolSize(), removeDirectory, &ctx);
+    if (pool == NULL || submitWork(pool, -1, rootNode) != SUCCESS) {
+        destroyWorkPool(pool);
+        close(rootFd);
+        free(rootNode);
+        return ERROR_UNKNOWN;
+    }
+    
+    waitWorkPool(pool);
+    destroyWorkPool(pool);
+    
+    if (stats != NULL) {
+        stats->files = ctx.files;
+        stats->directories = ctx.directories;
+        stats->failures = ctx.failures;
+    }
+    return SUCCESS;
+}
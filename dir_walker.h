@@ -0,0 +1,81 @@
+/**
+ * dir_walker.h
+ * Paralel dizin ağacı gezgini için fonksiyon tanımlamaları
+ *
+ * Dizinler iş çalan havuzda paralel okunur. Alt dizinler üst dizinin açık
+ * tanımlayıcısına göre openat ile açıldığından yollar her seviyede yeniden
+ * çözülmez ve MAX_PATH_LENGTH sınırı uygulanmaz.
+ */
+
+#ifndef DIR_WALKER_H
+#define DIR_WALKER_H
+
+#include "file_system.h"
+
+/**
+ * Gezinti sırasında bulunan her girdi için çağrılan fonksiyon
+ * 
+ * @param path Köke göre göreli yol ("alt/dosya.txt")
+ * @param isDir Girdi dizin mi (dizine bağlantılar dahil)
+ * @param workerIndex Çağıran iş parçacığının sırası (sıralı modda 0)
+ * @param userData Kullanıcı verisi
+ * @return 0: Devam, diğer: Gezintiyi durdur
+ */
+typedef int (*WalkEntryCallback)(const char* path, int isDir, int workerIndex, void* userData);
+
+/**
+ * Gezinti seçenekleri
+ */
+typedef struct {
+    int threads;                // İş parçacığı sayısı (0: varsayılan)
+    int ordered;                // 1: Girdiler toplanır ve yol sırasıyla tek iş parçacığından iletilir
+    DirEntryCallback filter;    // İletilecek girdileri seçer (NULL: hepsi); iş parçacıklarından eşzamanlı çağrılır
+    void* filterData;
+} WalkOptions;
+
+/**
+ * Gezinti sonucu
+ */
+typedef struct {
+    unsigned long directories;  // Okunan dizin sayısı
+    unsigned long entries;      // İletilen girdi sayısı
+    unsigned long unreadable;   // Açılamayan/okunamayan alt dizin sayısı
+} WalkStats;
+
+/**
+ * Ağaç silme sonucu
+ */
+typedef struct {
+    unsigned long files;        // Silinen dizin olmayan girdi sayısı
+    unsigned long directories;  // Silinen dizin sayısı (kök dahil)
+    unsigned long failures;     // Silinemeyen girdi sayısı
+} RemoveStats;
+
+/**
+ * Dizin ağacını paralel gezer. Sembolik bağlantılar listelenir ama izlenmez.
+ * Sırasız modda callback farklı iş parçacıklarından eşzamanlı çağrılabilir.
+ * 
+ * @param root Kök dizin
+ * @param options Seçenekler (NULL: varsayılanlar, sırasız)
+ * @param callback Her girdi için çağrılacak fonksiyon
+ * @param userData Geri çağırma fonksiyonuna iletilecek veri
+ * @param stats Sonuç sayaçları (NULL olabilir; hata durumunda da sıfırlanır)
+ * @return Başarı durumu (yalnızca kök dizin açılamazsa hata)
+ */
+ErrorCode walkDirectoryTree(const char* root, const WalkOptions* options,
+                            WalkEntryCallback callback, void* userData, WalkStats* stats);
+
+/**
+ * Dizin ağacını aşağıdan yukarıya paralel siler. Alt ağaçlar farklı iş
+ * parçacıklarında silinir; her dizin, son alt dizini silindiğinde üst dizinin
+ * tanımlayıcısına göre unlinkat ile kaldırılır. Sembolik bağlantılar izlenmez,
+ * bağlantının kendisi silinir. Kök bir bağlantıysa silme yapılmaz.
+ * 
+ * @param root Silinecek kök dizin
+ * @param threads İş parçacığı sayısı (0: varsayılan)
+ * @param stats Sonuç sayaçları (NULL olabilir; hata durumunda da sıfırlanır)
+ * @return Başarı durumu (yalnızca kök dizin açılamazsa hata; silinemeyen girdiler stats->failures'ta)
+ */
+ErrorCode removeDirectoryTree(const char* root, int threads, RemoveStats* stats);
+
+#endif /* DIR_WALKER_H */
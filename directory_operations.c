@@ -6,6 +6,58 @@
 #include "directory_operations.h"
 #include "logger.h"
 #include "utils.h"
+#include "executor.h"
+#include "dir_walker.h"
+#include "dir_copy.h"
+#include "work_pool.h"
+#include "extension_index.h"
+#include <sys/mman.h>
+
+// Listeleme sırasında yapılan stat çağrısı sayısı (--stats)
+static unsigned long long listingStatCount = 0;
+
+/**
+ * Listeleme sırasında yapılan stat çağrısı sayısını döndürür
+ */
+unsigned long long getListingStatCount() {
+    return __atomic_load_n(&listingStatCount, __ATOMIC_RELAXED);
+}
+
+/**
+ * Girdinin türünü belirler. Dosya sistemi d_type sağlıyorsa stat yapılmaz;
+ * yalnızca DT_UNKNOWN ve sembolik bağlantılar (hedefin türü gerektiğinden)
+ * için dizine göre fstatat çağrılır.
+ */
+int classifyDirEntry(int dirFd, const struct dirent* entry, int* isDir) {
+    struct stat st;
+    
+    switch (entry->d_type) {
+        case DT_DIR:
+            *isDir = 1;
+            return 1;
+        case DT_LNK:
+            break;
+        case DT_UNKNOWN:
+            __atomic_fetch_add(&listingStatCount, 1, __ATOMIC_RELAXED);
+            if (fstatat(dirFd, entry->d_name, &st, AT_SYMLINK_NOFOLLOW) == -1) {
+                *isDir = 0;
+                return 0;
+            }
+            if (!S_ISLNK(st.st_mode)) {
+                *isDir = S_ISDIR(st.st_mode);
+                return *isDir;
+            }
+            break;
+        default:
+            *isDir = 0;
+            return 0;
+    }
+    
+    // Sembolik bağlantı: hedef dizinse dizin olarak gösterilir ama izlenmez
+    __atomic_fetch_add(&listingStatCount, 1, __ATOMIC_RELAXED);
+    *isDir = (fstatat(dirFd, entry->d_name, &st, 0) == 0 && S_ISDIR(st.st_mode));
+    return 0;
+}
 
 /**
  * Dizinin boş olup olmadığını kontrol eder
@@ -42,264 +94,882 @@ int isDirEmpty(const char* dirName) {
     return (count == 0);  // Eğer count 0 ise dizin boştur
 }
 
+/**
+ * Dizin içeriğini her girdi için geri çağırma fonksiyonuyla iletir
+ */
+ErrorCode listDirEntries(const char* dirName, DirEntryCallback callback, void* userData) {
+    DIR* dir;
+    struct dirent* entry;
+    
+    if (dirName == NULL || callback == NULL) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    // Dizini aç
+    dir = opendir(dirName);
+    if (dir == NULL) {
+        if (errno == EACCES) {
+            return ERROR_PERMISSION_DENIED;
+        }
+        return (errno == ENOENT || errno == ENOTDIR) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+    }
+    
+    // Dizin içeriğini oku
+    while ((entry = readdir(dir)) != NULL) {
+        // "." ve ".." öğelerini atla
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+            continue;
+        }
+        
+        int isDir;
+        classifyDirEntry(dirfd(dir), entry, &isDir);
+        
+        if (callback(entry->d_name, isDir, userData) != 0) {
+            break;
+        }
+    }
+    
+    closedir(dir);
+    return SUCCESS;
+}
+
+/**
+ * Belirtilen uzantıya sahip dosyaları geri çağırma fonksiyonuyla iletir
+ */
+ErrorCode listFilesByExtensionEntries(const char* dirName, const char* extension,
+                                      DirEntryCallback callback, void* userData) {
+    DIR* dir;
+    struct dirent* entry;
+    
+    if (dirName == NULL || extension == NULL || callback == NULL) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    // İndeks açıksa ve sorguyu yanıtlayabiliyorsa dizin taranmaz
+    if (isExtensionIndexEnabled()) {
+        int handled;
+        ErrorCode result = queryExtensionIndex(dirName, extension, callback, userData, &handled);
+        if (handled) {
+            return result;
+        }
+    }
+    
+    // Dizini aç
+    dir = opendir(dirName);
+    if (dir == NULL) {
+        if (errno == EACCES) {
+            return ERROR_PERMISSION_DENIED;
+        }
+        return (errno == ENOENT || errno == ENOTDIR) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+    }
+    
+    // Uzantı uzunluğu
+    size_t extLen = strlen(extension);
+    
+    // Dizin içeriğini oku ve filtrele
+    while ((entry = readdir(dir)) != NULL) {
+        // Dosya adının uzunluğu
+        size_t nameLen = strlen(entry->d_name);
+        
+        // Eğer dosya adı uzantıdan kısaysa, atla
+        if (nameLen <= extLen) {
+            continue;
+        }
+        
+        // Uzantıyı kontrol et 
+        //"belge.txt" + 9 - 4 = "belge.txt" dizisindeki 5. indeksten itibaren olan kısım = ".txt"
+        //strcmp(".txt", ".txt") = 0
+        if (strcmp(entry->d_name + nameLen - extLen, extension) == 0) {
+            // Dizin değilse ve uzantı eşleşiyorsa ilet
+            int isDir;
+            classifyDirEntry(dirfd(dir), entry, &isDir);
+            if (!isDir && callback(entry->d_name, 0, userData) != 0) {
+                break;
+            }
+        }
+    }
+    
+    closedir(dir);
+    return SUCCESS;
+}
+
+/**
+ * Derlenmiş desenlere uyan dosyaların her biri için geri çağırma fonksiyonunu çağırır
+ */
+ErrorCode filterFileEntries(const char* dirName, const FileMatcher* matcher,
+                            DirEntryCallback callback, void* userData) {
+    DIR* dir;
+    struct dirent* entry;
+    
+    if (dirName == NULL || matcher == NULL || callback == NULL) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    dir = opendir(dirName);
+    if (dir == NULL) {
+        if (errno == EACCES) {
+            return ERROR_PERMISSION_DENIED;
+        }
+        return (errno == ENOENT || errno == ENOTDIR) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+    }
+    
+    // Tüm desenler tek geçişte denenir; tür yalnızca eşleşen adlar için belirlenir
+    while ((entry = readdir(dir)) != NULL) {
+        if (!matchFileName(matcher, entry->d_name, strlen(entry->d_name))) {
+            continue;
+        }
+        
+        int isDir;
+        classifyDirEntry(dirfd(dir), entry, &isDir);
+        if (!isDir && callback(entry->d_name, 0, userData) != 0) {
+            break;
+        }
+    }
+    
+    closedir(dir);
+    return SUCCESS;
+}
+
+/**
+ * listDir için bir dizin girdisini çıktıya yazar
+ */
+static int writeDirEntry(const char* name, int isDir, void* userData) {
+    char line[MAX_PATH_LENGTH + 10];
+    int len;
+    
+    (void)userData;
+    if (isDir) {
+        len = string_format(line, sizeof(line), "[DIR] %s\n", name);
+    } else {
+        len = string_format(line, sizeof(line), "[FILE] %s\n", name);
+    }
+    write(getOutputFd(), line, len);
+    
+    return 0;
+}
+
+/**
+ * listFilesByExtension için eşleşen dosyayı çıktıya yazar ve sayar
+ */
+static int writeMatchingFile(const char* name, int isDir, void* userData) {
+    char line[MAX_PATH_LENGTH + 2];
+    int len;
+    
+    (void)isDir;
+    len = string_format(line, sizeof(line), "%s\n", name);
+    write(getOutputFd(), line, len);
+    (*(int*)userData)++;
+    
+    return 0;
+}
+
 /**
  * Verilen isimde yeni bir dizin oluşturur
  */
 ErrorCode createDir(const char* dirName) {
-    char logMsg[MAX_PATH_LENGTH + 50];
-    
     // Dizinin veya dosyanın zaten var olup olmadığını kontrol et
     if (fileExists(dirName)) {
-        string_format(logMsg, sizeof(logMsg), "Dizin veya dosya zaten mevcut: %s", dirName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_DIR_EXISTS, dirName);
         return ERROR_FILE_EXISTS;
     }
     
     // Dizini oluştur
     if (mkdir(dirName, 0755) != 0) { // 0755 izni, sahibinin okuyabildiği, yazabildiği ve yürütebildiği, diğerlerinin ise sadece okuyabildiği ve yürütebildiği bir dizin oluşturur
-        string_format(logMsg, sizeof(logMsg), "Dizin oluşturma hatası: %s", dirName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_DIR_CREATE_ERROR, dirName);
         return ERROR_UNKNOWN;
     }
     
     // Log mesajı oluştur
-    string_format(logMsg, sizeof(logMsg), "Dizin oluşturuldu: %s", dirName);
-    logMessage(LOG_INFO, logMsg);
+    logEvent(LOG_INFO, OP_DIR_CREATED, dirName);
     
     return SUCCESS;
 }
 
+/**
+ * listDir görevi: dizin içeriğini çıktıya yazar
+ */
+static int listDirTask(void* arg) {
+    const char* dirName = arg;
+    
+    //printf("Dizin içeriği (%s):\n", dirName);
+    //printf("---------------------------------------\n");
+    const char* header = "Dizin içeriği (";
+    write(getOutputFd(), header, strlen(header));
+    write(getOutputFd(), dirName, strlen(dirName));
+    const char* separator = "):\n---------------------------------------\n";
+    write(getOutputFd(), separator, strlen(separator));
+    
+    // Dizin içeriğini oku ve yazdır
+    if (listDirEntries(dirName, writeDirEntry, NULL) != SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    
+    const char* footer = "---------------------------------------\n";
+    write(getOutputFd(), footer, strlen(footer));
+    
+    return EXIT_SUCCESS;
+}
+
 /**
  * Dizin içeriğini listeler
  */
 ErrorCode listDir(const char* dirName) {
-    pid_t pid;
     int status;
-    char logMsg[MAX_PATH_LENGTH + 50];
     
     // Dizinin var olup olmadığını kontrol et
     if (!fileExists(dirName) || !isDirectory(dirName)) {
-        string_format(logMsg, sizeof(logMsg), "Dizin bulunamadı: %s", dirName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, dirName);
         return ERROR_FILE_NOT_FOUND;
     }
     
-    // Fork ile yeni bir işlem oluştur
-    pid = fork();
+    // Listelemeyi çalıştır (yalıtım modunda ayrı işlemde)
+    status = runTask(listDirTask, (void*)dirName);
     
-    if (pid < 0) {
+    if (status == -1) {
         // Fork hatası
-        string_format(logMsg, sizeof(logMsg), "Fork hatası: %s", dirName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_FORK_ERROR, dirName);
         return ERROR_UNKNOWN;
-    } else if (pid == 0) {
-        // Çocuk işlemi
-        DIR* dir;
-        struct dirent* entry;
-        
-        //printf("Dizin içeriği (%s):\n", dirName);
-        //printf("---------------------------------------\n");
-        const char* header = "Dizin içeriği (";
-        write(STDOUT_FILENO, header, strlen(header));
-        write(STDOUT_FILENO, dirName, strlen(dirName));
-        const char* separator = "):\n---------------------------------------\n";
-        write(STDOUT_FILENO, separator, strlen(separator));
-        
-        // Dizini aç
-        dir = opendir(dirName);
-        if (dir == NULL) {
-            exit(EXIT_FAILURE);
-        }
-        
-        // Dizin içeriğini oku ve yazdır
-        while ((entry = readdir(dir)) != NULL) {
-            // "." ve ".." öğelerini atla
-            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
-                continue;
-            }
-            
-            char fullPath[MAX_PATH_LENGTH];
-            string_format(fullPath, sizeof(fullPath), "%s/%s", dirName, entry->d_name);
-            
-            char line[MAX_PATH_LENGTH + 10];
-            int len;
-            
-            if (isDirectory(fullPath)) {
-                len = string_format(line, sizeof(line), "[DIR] %s\n", entry->d_name);
-                write(STDOUT_FILENO, line, len);
-            } else {
-                len = string_format(line, sizeof(line), "[FILE] %s\n", entry->d_name);
-                write(STDOUT_FILENO, line, len);
-            }
-        }
-        
-        const char* footer = "---------------------------------------\n";
-        write(STDOUT_FILENO, footer, strlen(footer));
-        
-        closedir(dir);
-        exit(EXIT_SUCCESS);
+    } else if (status == EXIT_SUCCESS) {
+        // Log mesajı oluştur
+        logEvent(LOG_INFO, OP_DIR_LISTED, dirName);
+        return SUCCESS;
     } else {
-        // Ebeveyn işlemi
-        waitpid(pid, &status, 0);
-        
-        if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) {
-            // Log mesajı oluştur
-            string_format(logMsg, sizeof(logMsg), "Dizin listelendi: %s", dirName);
-            logMessage(LOG_INFO, logMsg);
-            return SUCCESS;
-        } else {
-            string_format(logMsg, sizeof(logMsg), "Dizin listeleme hatası: %s", dirName);
-            logMessage(LOG_ERROR, logMsg);
-            return ERROR_UNKNOWN;
-        }
+        logEvent(LOG_ERROR, OP_DIR_LIST_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    }
+}
+
+/**
+ * listFilesByExtension görevinin argümanları
+ */
+typedef struct {
+    const char* dirName;
+    const char* extension;
+} ExtensionListArgs;
+
+/**
+ * listFilesByExtension görevi: eşleşen dosyaları çıktıya yazar
+ */
+static int listFilesByExtensionTask(void* arg) {
+    const ExtensionListArgs* args = arg;
+    int found = 0;
+    
+    char header[MAX_PATH_LENGTH + 100];
+    int len = string_format(header, sizeof(header), "'%s' uzantılı dosyalar (%s):\n---------------------------------------\n", args->extension, args->dirName);
+    write(getOutputFd(), header, len);
+    
+    // Dizin içeriğini oku ve filtrele
+    if (listFilesByExtensionEntries(args->dirName, args->extension, writeMatchingFile, &found) != SUCCESS) {
+        return EXIT_FAILURE;
     }
+    
+    if (!found) {
+        const char* msg = "Bu uzantıya sahip dosya bulunamadı.\n";
+        write(getOutputFd(), msg, strlen(msg));
+    }
+    
+    const char* footer = "---------------------------------------\n";
+    write(getOutputFd(), footer, strlen(footer));
+    
+    return EXIT_SUCCESS;
 }
 
 /**
  * Belirtilen uzantıya sahip dosyaları listeler
  */
 ErrorCode listFilesByExtension(const char* dirName, const char* extension) {
-    pid_t pid;
     int status;
     char logMsg[MAX_PATH_LENGTH + 100];
+    ExtensionListArgs args = { dirName, extension };
     
     // Dizinin var olup olmadığını kontrol et
     if (!fileExists(dirName) || !isDirectory(dirName)) {
-        string_format(logMsg, sizeof(logMsg), "Dizin bulunamadı: %s", dirName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, dirName);
         return ERROR_FILE_NOT_FOUND;
     }
     
-    // Fork ile yeni bir işlem oluştur
-    pid = fork();
+    // Listelemeyi çalıştır (yalıtım modunda ayrı işlemde)
+    status = runTask(listFilesByExtensionTask, &args);
     
-    if (pid < 0) {
+    if (status == -1) {
         // Fork hatası
-        string_format(logMsg, sizeof(logMsg), "Fork hatası: %s", dirName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_FORK_ERROR, dirName);
         return ERROR_UNKNOWN;
-    } else if (pid == 0) {
-        // Çocuk işlemi
-        DIR* dir;
-        struct dirent* entry;
-        int found = 0;
-        
-        char header[MAX_PATH_LENGTH + 100];
-        int len = string_format(header, sizeof(header), "'%s' uzantılı dosyalar (%s):\n---------------------------------------\n", extension, dirName);
-        write(STDOUT_FILENO, header, len);
-        
-        // Dizini aç
-        dir = opendir(dirName);
-        if (dir == NULL) {
-            exit(EXIT_FAILURE);
-        }
-        
-        // Dizin içeriğini oku ve filtrele
-        while ((entry = readdir(dir)) != NULL) {
-            // Dosya adının uzunluğu
-            size_t nameLen = strlen(entry->d_name);
-            // Uzantı uzunluğu
-            size_t extLen = strlen(extension);
-            
-            // Eğer dosya adı uzantıdan kısaysa, atla
-            if (nameLen <= extLen) {
-                continue;
-            }
-            
-            // Uzantıyı kontrol et 
-            //"belge.txt" + 9 - 4 = "belge.txt" dizisindeki 5. indeksten itibaren olan kısım = ".txt"
-            //strcmp(".txt", ".txt") = 0
-            if (strcmp(entry->d_name + nameLen - extLen, extension) == 0) {
-                char fullPath[MAX_PATH_LENGTH];
-                string_format(fullPath, sizeof(fullPath), "%s/%s", dirName, entry->d_name);
-                
-                // Dizin değilse ve uzantı eşleşiyorsa yazdır
-                if (!isDirectory(fullPath)) {
-                    char line[MAX_PATH_LENGTH + 2];
-                    len = string_format(line, sizeof(line), "%s\n", entry->d_name);
-                    write(STDOUT_FILENO, line, len);
-                    found = 1;
-                }
-            }
-        }
-        
-        if (!found) {
-            const char* msg = "Bu uzantıya sahip dosya bulunamadı.\n";
-            write(STDOUT_FILENO, msg, strlen(msg));
-        }
-        
-        const char* footer = "---------------------------------------\n";
-        write(STDOUT_FILENO, footer, strlen(footer));
-        
-        closedir(dir);
-        exit(EXIT_SUCCESS);
+    } else if (status == EXIT_SUCCESS) {
+        // Log mesajı oluştur
+        string_format(logMsg, sizeof(logMsg), "%s, uzantı: %s", dirName, extension);
+        logEvent(LOG_INFO, OP_EXTENSION_LISTED, logMsg);
+        return SUCCESS;
     } else {
-        // Ebeveyn işlemi
-        waitpid(pid, &status, 0);
-        
-        if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) {
-            // Log mesajı oluştur
-            string_format(logMsg, sizeof(logMsg), "Uzantıya göre dosyalar listelendi: %s, uzantı: %s", dirName, extension);
-            logMessage(LOG_INFO, logMsg);
-            return SUCCESS;
-        } else {
-            string_format(logMsg, sizeof(logMsg), "Uzantıya göre listeleme hatası: %s", dirName);
-            logMessage(LOG_ERROR, logMsg);
-            return ERROR_UNKNOWN;
-        }
+        logEvent(LOG_ERROR, OP_EXTENSION_LIST_ERROR, dirName);
+        return ERROR_UNKNOWN;
     }
 }
 
+/**
+ * filterFiles görevinin argümanları
+ */
+typedef struct {
+    const char* dirName;
+    const char* patterns;
+    const FileMatcher* matcher;
+} FilterListArgs;
+
+/**
+ * filterFiles görevi: desenlere uyan dosyaları çıktıya yazar
+ */
+static int filterFilesTask(void* arg) {
+    const FilterListArgs* args = arg;
+    int found = 0;
+    
+    char header[MAX_PATH_LENGTH * 2 + 100];
+    int len = string_format(header, sizeof(header), "'%s' desenlerine uyan dosyalar (%s):\n---------------------------------------\n", args->patterns, args->dirName);
+    write(getOutputFd(), header, len);
+    
+    if (filterFileEntries(args->dirName, args->matcher, writeMatchingFile, &found) != SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    
+    if (!found) {
+        const char* msg = "Bu desenlere uyan dosya bulunamadı.\n";
+        write(getOutputFd(), msg, strlen(msg));
+    }
+    
+    const char* footer = "---------------------------------------\n";
+    write(getOutputFd(), footer, strlen(footer));
+    
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Desenlerden birine uyan dosyaları listeler
+ */
+ErrorCode filterFiles(const char* dirName, const char* patterns) {
+    FileMatcher* matcher;
+    char logMsg[MAX_PATH_LENGTH * 2 + 100];
+    int status;
+    
+    // Dizinin var olup olmadığını kontrol et
+    if (!fileExists(dirName) || !isDirectory(dirName)) {
+        logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, dirName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Desenler bir kez derlenir
+    string_format(logMsg, sizeof(logMsg), "%s, desen: %s", dirName, patterns);
+    ErrorCode result = compileFileMatcher(patterns, &matcher);
+    if (result != SUCCESS) {
+        logEvent(LOG_ERROR, OP_FILTER_ERROR, logMsg);
+        return result;
+    }
+    
+    FilterListArgs args = { dirName, patterns, matcher };
+    status = runTask(filterFilesTask, &args);
+    freeFileMatcher(matcher);
+    
+    if (status == -1) {
+        // Fork hatası
+        logEvent(LOG_ERROR, OP_FORK_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    } else if (status == EXIT_SUCCESS) {
+        logEvent(LOG_INFO, OP_FILES_FILTERED, logMsg);
+        return SUCCESS;
+    } else {
+        logEvent(LOG_ERROR, OP_FILTER_ERROR, logMsg);
+        return ERROR_UNKNOWN;
+    }
+}
+
+/**
+ * Ağaç listeleme görevinin argümanları ve çıktı durumu
+ */
+typedef struct {
+    const char* dirName;
+    const char* extension;      // NULL: tüm girdiler (matcher verilmediyse)
+    const char* patterns;       // filterFiles desenleri (başlık için)
+    const FileMatcher* matcher; // NULL değilse yalnızca desenlere uyan dosyalar
+    int ordered;
+    int outputFd;               // Çağıran iş parçacığının çıktısı (iş parçacıkları kendi çıktısını bilmez)
+    unsigned long found;
+    LineBuffer* buffers;        // İş parçacığı başına
+} TreeListArgs;
+
+/**
+ * Ağaç listelemesinde girdiyi iş parçacığının buffer'ına ekler
+ */
+static int writeTreeEntry(const char* path, int isDir, int workerIndex, void* userData) {
+    TreeListArgs* args = userData;
+    const char* prefix = (args->extension != NULL || args->matcher != NULL) ? "" : (isDir ? "[DIR] " : "[FILE] ");
+    struct iovec iov[3] = {
+        { (void*)prefix, strlen(prefix) },
+        { (void*)path, strlen(path) },
+        { "\n", 1 }
+    };
+    
+    appendLineBuffer(&args->buffers[workerIndex], iov, 3);
+    
+    __atomic_add_fetch(&args->found, 1, __ATOMIC_RELAXED);
+    return 0;
+}
+
+/**
+ * Ağaç listelemesinde uzantıya uyan dosyaları seçer
+ */
+static int matchTreeExtension(const char* name, int isDir, void* userData) {
+    const char* extension = userData;
+    size_t nameLen = strlen(name);
+    size_t extLen = strlen(extension);
+    
+    return !isDir && nameLen > extLen && strcmp(name + nameLen - extLen, extension) == 0;
+}
+
+/**
+ * Ağaç listelemesinde desenlere uyan dosyaları seçer
+ */
+static int matchTreePatterns(const char* name, int isDir, void* userData) {
+    return !isDir && matchFileName(userData, name, strlen(name));
+}
+
+/**
+ * Ağaç listeleme görevi: alt dizinlerle birlikte listeler
+ */
+static int listTreeTask(void* arg) {
+    TreeListArgs* args = arg;
+    WalkOptions options = { getDefaultPoolSize(), args->ordered, NULL, NULL };
+    WalkStats stats;
+    char header[MAX_PATH_LENGTH * 2 + 100];
+    int len;
+    
+    if (args->matcher != NULL) {
+        options.filter = matchTreePatterns;
+        options.filterData = (void*)args->matcher;
+        len = string_format(header, sizeof(header), "'%s' desenlerine uyan dosyalar (%s, alt dizinlerle):\n---------------------------------------\n", args->patterns, args->dirName);
+    } else if (args->extension != NULL) {
+        options.filter = matchTreeExtension;
+        options.filterData = (void*)args->extension;
+        len = string_format(header, sizeof(header), "'%s' uzantılı dosyalar (%s, alt dizinlerle):\n---------------------------------------\n", args->extension, args->dirName);
+    } else {
+        len = string_format(header, sizeof(header), "Dizin ağacı (%s):\n---------------------------------------\n", args->dirName);
+    }
+    
+    args->outputFd = getOutputFd();
+    args->found = 0;
+    args->buffers = createLineBuffers(options.threads, args->outputFd);
+    if (args->buffers == NULL) {
+        return EXIT_FAILURE;
+    }
+    
+    write(args->outputFd, header, len);
+    
+    ErrorCode result = walkDirectoryTree(args->dirName, &options, writeTreeEntry, args, &stats);
+    destroyLineBuffers(args->buffers, options.threads);
+    
+    if (result != SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    
+    if (args->matcher != NULL && args->found == 0) {
+        const char* msg = "Bu desenlere uyan dosya bulunamadı.\n";
+        write(args->outputFd, msg, strlen(msg));
+    } else if (args->extension != NULL && args->found == 0) {
+        const char* msg = "Bu uzantıya sahip dosya bulunamadı.\n";
+        write(args->outputFd, msg, strlen(msg));
+    }
+    
+    const char* footer = "---------------------------------------\n";
+    write(args->outputFd, footer, strlen(footer));
+    
+    if (stats.unreadable > 0) {
+        len = string_format(header, sizeof(header), "Uyarı: %lu alt dizin okunamadı.\n", stats.unreadable);
+        write(args->outputFd, header, len);
+    }
+    
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Dizin ağacını alt dizinlerle birlikte paralel listeler
+ */
+ErrorCode listDirRecursive(const char* dirName, int ordered) {
+    TreeListArgs args = { dirName, NULL, NULL, NULL, ordered, -1, 0, NULL };
+    int status;
+    
+    // Dizinin var olup olmadığını kontrol et
+    if (!fileExists(dirName) || !isDirectory(dirName)) {
+        logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, dirName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Listelemeyi çalıştır (yalıtım modunda ayrı işlemde)
+    status = runTask(listTreeTask, &args);
+    
+    if (status == -1) {
+        // Fork hatası
+        logEvent(LOG_ERROR, OP_FORK_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    } else if (status == EXIT_SUCCESS) {
+        // Log mesajı oluştur
+        logEvent(LOG_INFO, OP_DIR_LISTED, dirName);
+        return SUCCESS;
+    } else {
+        logEvent(LOG_ERROR, OP_DIR_LIST_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    }
+}
+
+/**
+ * Belirtilen uzantıya sahip dosyaları alt dizinlerle birlikte paralel listeler
+ */
+ErrorCode listFilesByExtensionRecursive(const char* dirName, const char* extension, int ordered) {
+    TreeListArgs args = { dirName, extension, NULL, NULL, ordered, -1, 0, NULL };
+    char logMsg[MAX_PATH_LENGTH + 100];
+    int status;
+    
+    // Dizinin var olup olmadığını kontrol et
+    if (!fileExists(dirName) || !isDirectory(dirName)) {
+        logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, dirName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Listelemeyi çalıştır (yalıtım modunda ayrı işlemde)
+    status = runTask(listTreeTask, &args);
+    
+    if (status == -1) {
+        // Fork hatası
+        logEvent(LOG_ERROR, OP_FORK_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    } else if (status == EXIT_SUCCESS) {
+        // Log mesajı oluştur
+        string_format(logMsg, sizeof(logMsg), "%s, uzantı: %s", dirName, extension);
+        logEvent(LOG_INFO, OP_EXTENSION_LISTED, logMsg);
+        return SUCCESS;
+    } else {
+        logEvent(LOG_ERROR, OP_EXTENSION_LIST_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    }
+}
+
+/**
+ * deleteDir görevi: boş dizini siler
+ */
+static int deleteDirTask(void* arg) {
+    return (rmdir((const char*)arg) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 /**
  * Dizini siler (sadece boş dizinler silinebilir)
  */
 ErrorCode deleteDir(const char* dirName) {
-    pid_t pid;
     int status;
-    char logMsg[MAX_PATH_LENGTH + 50];
     
     // Dizinin var olup olmadığını kontrol et
     if (!fileExists(dirName) || !isDirectory(dirName)) {
-        string_format(logMsg, sizeof(logMsg), "Dizin bulunamadı: %s", dirName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, dirName);
         return ERROR_FILE_NOT_FOUND;
     }
     
     // Dizinin boş olup olmadığını kontrol et
     if (!isDirEmpty(dirName)) {
-        string_format(logMsg, sizeof(logMsg), "Dizin boş değil: %s", dirName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_DIR_NOT_EMPTY, dirName);
         return ERROR_DIR_NOT_EMPTY;
     }
     
-    // Fork ile yeni bir işlem oluştur
-    pid = fork();
+    // Silme işlemini çalıştır (yalıtım modunda ayrı işlemde)
+    status = runTask(deleteDirTask, (void*)dirName);
     
-    if (pid < 0) {
+    if (status == -1) {
         // Fork hatası
-        string_format(logMsg, sizeof(logMsg), "Fork hatası: %s", dirName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_FORK_ERROR, dirName);
         return ERROR_UNKNOWN;
-    } else if (pid == 0) {
-        // Çocuk işlemi
-        if (rmdir(dirName) != 0) {
-            exit(EXIT_FAILURE);
-        }
-        
-        exit(EXIT_SUCCESS);
+    } else if (status == EXIT_SUCCESS) {
+        // Log mesajı oluştur
+        logEvent(LOG_INFO, OP_DIR_DELETED, dirName);
+        return SUCCESS;
     } else {
-        // Ebeveyn işlemi
-        waitpid(pid, &status, 0);
-        
-        if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) {
-            // Log mesajı oluştur
-            string_format(logMsg, sizeof(logMsg), "Dizin silindi: %s", dirName);
-            logMessage(LOG_INFO, logMsg);
-            return SUCCESS;
-        } else {
-            string_format(logMsg, sizeof(logMsg), "Dizin silme hatası: %s", dirName);
-            logMessage(LOG_ERROR, logMsg);
-            return ERROR_UNKNOWN;
-        }
+        logEvent(LOG_ERROR, OP_DIR_DELETE_ERROR, dirName);
+        return ERROR_UNKNOWN;
     }
-} 
\ No newline at end of file
+}
+
+/**
+ * deleteDirRecursive görevinin argümanları ve sonucu. Yalıtım modunda
+ * sonucun ebeveyne ulaşması için paylaşılan bellekte tutulur.
+ */
+typedef struct {
+    const char* dirName;
+    ErrorCode result;
+    RemoveStats stats;
+    unsigned long long elapsedMs;
+} DeleteTreeArgs;
+
+/**
+ * deleteDirRecursive görevi: ağacı siler ve özeti çıktıya yazar
+ */
+static int deleteTreeTask(void* arg) {
+    DeleteTreeArgs* args = arg;
+    struct timespec start, end;
+    char line[200];
+    int len;
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    args->result = removeDirectoryTree(args->dirName, getDefaultPoolSize(), &args->stats);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    args->elapsedMs = (unsigned long long)((end.tv_sec - start.tv_sec) * 1000LL + (end.tv_nsec - start.tv_nsec) / 1000000);
+    
+    if (args->result != SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    
+    len = string_format(line, sizeof(line), "Silinen: %lu dosya, %lu dizin (%llu ms)\n",
+                        args->stats.files, args->stats.directories, args->elapsedMs);
+    write(getOutputFd(), line, len);
+    if (args->stats.failures > 0) {
+        len = string_format(line, sizeof(line), "Uyarı: %lu girdi silinemedi.\n", args->stats.failures);
+        write(getOutputFd(), line, len);
+        return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Dizini içeriğiyle birlikte siler
+ */
+ErrorCode deleteDirRecursive(const char* dirName) {
+    char logMsg[MAX_PATH_LENGTH + 200];
+    struct stat st;
+    int status;
+    
+    // Dizinin var olup olmadığını kontrol et; bağlantı üzerinden hedef silinmez
+    if (lstat(dirName, &st) == -1 || !S_ISDIR(st.st_mode)) {
+        logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, dirName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    DeleteTreeArgs* args = mmap(NULL, sizeof(DeleteTreeArgs), PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (args == MAP_FAILED) {
+        logEvent(LOG_ERROR, OP_DIR_DELETE_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    }
+    memset(args, 0, sizeof(*args));
+    args->dirName = dirName;
+    args->result = ERROR_UNKNOWN;
+    
+    // Silmeyi çalıştır (yalıtım modunda ayrı işlemde)
+    status = runTask(deleteTreeTask, args);
+    
+    // Tüm silme işlemi için tek özet kaydı
+    string_format(logMsg, sizeof(logMsg), "%s (%lu dosya, %lu dizin, %llu ms)",
+                  dirName, args->stats.files, args->stats.directories, args->elapsedMs);
+    ErrorCode result = args->result;
+    unsigned long failures = args->stats.failures;
+    munmap(args, sizeof(DeleteTreeArgs));
+    
+    if (status == -1) {
+        // Fork hatası
+        logEvent(LOG_ERROR, OP_FORK_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    } else if (status == EXIT_SUCCESS) {
+        logEvent(LOG_INFO, OP_DIR_TREE_DELETED, logMsg);
+        return SUCCESS;
+    } else if (result != SUCCESS) {
+        logEvent(LOG_ERROR, OP_DIR_DELETE_ERROR, dirName);
+        return result;
+    } else {
+        string_format(logMsg + strlen(logMsg), sizeof(logMsg) - strlen(logMsg), ", %lu girdi silinemedi", failures);
+        logEvent(LOG_ERROR, OP_DIR_DELETE_ERROR, logMsg);
+        return ERROR_UNKNOWN;
+    }
+}
+
+/**
+ * copyDir görevinin argümanları ve sonucu. Yalıtım modunda sonucun
+ * ebeveyne ulaşması için paylaşılan bellekte tutulur.
+ */
+typedef struct {
+    const char* source;
+    const char* destination;
+    long long maxInFlight;
+    int outputFd;
+    ErrorCode result;
+    CopyTreeStats stats;
+    CopyTreeStats lastStats;        // Önceki ilerleme bildirimi (hız hesabı için)
+    unsigned long long lastMs;
+    unsigned long long elapsedMs;
+} CopyTreeArgs;
+
+/**
+ * Bayt sayısını bir ondalık basamaklı MB olarak yazar
+ */
+static void formatMegabytes(char* buffer, size_t size, unsigned long long bytes) {
+    unsigned long long tenths = bytes * 10 / (1024 * 1024);
+    string_format(buffer, size, "%llu.%llu", tenths / 10, tenths % 10);
+}
+
+/**
+ * Kopyalama ilerlemesini ve son aralıktaki hızı çıktıya yazar
+ */
+static void writeCopyProgress(const CopyTreeStats* stats, unsigned long long elapsedMs, void* userData) {
+    CopyTreeArgs* args = userData;
+    char total[32], rate[32];
+    char line[200];
+    
+    unsigned long long intervalMs = (elapsedMs > args->lastMs) ? elapsedMs - args->lastMs : 1;
+    unsigned long long filesPerSecond = (stats->files - args->lastStats.files) * 1000ULL / intervalMs;
+    
+    formatMegabytes(total, sizeof(total), stats->bytes);
+    formatMegabytes(rate, sizeof(rate), (stats->bytes - args->lastStats.bytes) * 1000ULL / intervalMs);
+    int len = string_format(line, sizeof(line), "Kopyalanıyor: %lu dosya, %s MB (%llu dosya/s, %s MB/s)\n",
+                            stats->files, total, filesPerSecond, rate);
+    write(args->outputFd, line, len);
+    
+    args->lastStats = *stats;
+    args->lastMs = elapsedMs;
+}
+
+/**
+ * copyDir görevi: ağacı kopyalar, ilerlemeyi ve özeti çıktıya yazar
+ */
+static int copyTreeTask(void* arg) {
+    CopyTreeArgs* args = arg;
+    struct timespec start, end;
+    char total[32], rate[32];
+    char line[300];
+    int len;
+    
+    args->outputFd = getOutputFd();
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    args->result = copyDirectoryTree(args->source, args->destination, getDefaultPoolSize(), args->maxInFlight,
+                                     writeCopyProgress, args, &args->stats);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    args->elapsedMs = (unsigned long long)((end.tv_sec - start.tv_sec) * 1000LL + (end.tv_nsec - start.tv_nsec) / 1000000);
+    
+    if (args->result != SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    
+    unsigned long long elapsedMs = (args->elapsedMs > 0) ? args->elapsedMs : 1;
+    formatMegabytes(total, sizeof(total), args->stats.bytes);
+    formatMegabytes(rate, sizeof(rate), args->stats.bytes * 1000ULL / elapsedMs);
+    len = string_format(line, sizeof(line),
+                        "Kopyalanan: %lu dosya (%lu reflink), %lu dizin, %lu bağlantı, %s MB (%llu ms, %s MB/s)\n",
+                        args->stats.files, args->stats.reflinked, args->stats.directories, args->stats.links,
+                        total, args->elapsedMs, rate);
+    write(args->outputFd, line, len);
+    if (args->stats.skipped > 0) {
+        len = string_format(line, sizeof(line), "Uyarı: %lu özel dosya (FIFO, soket, aygıt) atlandı.\n", args->stats.skipped);
+        write(args->outputFd, line, len);
+    }
+    if (args->stats.failures > 0) {
+        len = string_format(line, sizeof(line), "Uyarı: %lu girdi kopyalanamadı.\n", args->stats.failures);
+        write(args->outputFd, line, len);
+        return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Dizini içeriğiyle birlikte kopyalar
+ */
+ErrorCode copyDir(const char* source, const char* destination, int maxInFlightMb) {
+    char logMsg[MAX_PATH_LENGTH * 2 + 200];
+    int status;
+    
+    if (maxInFlightMb < 0) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    // Kaynağın var olup olmadığını kontrol et
+    if (!fileExists(source) || !isDirectory(source)) {
+        logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, source);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Hedefin üzerine kopyalanmaz
+    if (fileExists(destination)) {
+        logEvent(LOG_ERROR, OP_DIR_EXISTS, destination);
+        return ERROR_FILE_EXISTS;
+    }
+    
+    CopyTreeArgs* args = mmap(NULL, sizeof(CopyTreeArgs), PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (args == MAP_FAILED) {
+        logEvent(LOG_ERROR, OP_DIR_COPY_ERROR, source);
+        return ERROR_UNKNOWN;
+    }
+    memset(args, 0, sizeof(*args));
+    args->source = source;
+    args->destination = destination;
+    args->maxInFlight = (long long)maxInFlightMb * 1024 * 1024;
+    args->result = ERROR_UNKNOWN;
+    
+    // Kopyalamayı çalıştır (yalıtım modunda ayrı işlemde)
+    status = runTask(copyTreeTask, args);
+    
+    // Tüm kopyalama için tek özet kaydı
+    string_format(logMsg, sizeof(logMsg), "%s -> %s (%lu dosya, %lu dizin, %llu bayt, %llu ms)",
+                  source, destination, args->stats.files, args->stats.directories,
+                  args->stats.bytes, args->elapsedMs);
+    ErrorCode result = args->result;
+    unsigned long failures = args->stats.failures;
+    munmap(args, sizeof(CopyTreeArgs));
+    
+    if (status == -1) {
+        // Fork hatası
+        logEvent(LOG_ERROR, OP_FORK_ERROR, source);
+        return ERROR_UNKNOWN;
+    } else if (status == EXIT_SUCCESS) {
+        logEvent(LOG_INFO, OP_DIR_COPIED, logMsg);
+        return SUCCESS;
+    } else if (result != SUCCESS) {
+        string_format(logMsg, sizeof(logMsg), "%s -> %s", source, destination);
+        logEvent(LOG_ERROR, OP_DIR_COPY_ERROR, logMsg);
+        return result;
+    } else {
+        string_format(logMsg + strlen(logMsg), sizeof(logMsg) - strlen(logMsg), ", %lu girdi kopyalanamadı", failures);
+        logEvent(LOG_ERROR, OP_DIR_COPY_ERROR, logMsg);
+        return ERROR_UNKNOWN;
+    }
+}
+
+/**
+ * Desenlerden birine uyan dosyaları alt dizinlerle birlikte paralel listeler
+ */
+ErrorCode filterFilesRecursive(const char* dirName, const char* patterns, int ordered) {
+    FileMatcher* matcher;
+    char logMsg[MAX_PATH_LENGTH * 2 + 100];
+    int status;
+    
+    // Dizinin var olup olmadığını kontrol et
+    if (!fileExists(dirName) || !isDirectory(dirName)) {
+        logEvent(LOG_ERROR, OP_DIR_NOT_FOUND, dirName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Desenler bir kez derlenir, tüm iş parçacıkları aynı eşleştiriciyi okur
+    string_format(logMsg, sizeof(logMsg), "%s, desen: %s", dirName, patterns);
+    ErrorCode result = compileFileMatcher(patterns, &matcher);
+    if (result != SUCCESS) {
+        logEvent(LOG_ERROR, OP_FILTER_ERROR, logMsg);
+        return result;
+    }
+    
+    TreeListArgs args = { dirName, NULL, patterns, matcher, ordered, -1, 0, NULL };
+    status = runTask(listTreeTask, &args);
+    freeFileMatcher(matcher);
+    
+    if (status == -1) {
+        // Fork hatası
+        logEvent(LOG_ERROR, OP_FORK_ERROR, dirName);
+        return ERROR_UNKNOWN;
+    } else if (status == EXIT_SUCCESS) {
+        logEvent(LOG_INFO, OP_FILES_FILTERED, logMsg);
+        return SUCCESS;
+    } else {
+        logEvent(LOG_ERROR, OP_FILTER_ERROR, logMsg);
+        return ERROR_UNKNOWN;
+    }
+}
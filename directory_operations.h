@@ -7,6 +7,7 @@
 #define DIRECTORY_OPERATIONS_H
 
 #include "file_system.h"
+#include "file_matcher.h"
 
 /**
  * Verilen isimde yeni bir dizin oluşturur
@@ -33,6 +34,100 @@ ErrorCode listDir(const char* dirName);
  */
 ErrorCode listFilesByExtension(const char* dirName, const char* extension);
 
+/**
+ * Dizin ağacını alt dizinlerle birlikte paralel listeler ("[DIR] alt", "[FILE] alt/dosya").
+ * Sembolik bağlantılar listelenir ama izlenmez.
+ * 
+ * @param dirName Kök dizin
+ * @param ordered 1: Yollar ağaç sırasıyla, 0: Bulundukları sırayla (daha hızlı)
+ * @return Başarı durumu
+ */
+ErrorCode listDirRecursive(const char* dirName, int ordered);
+
+/**
+ * Belirtilen uzantıya sahip dosyaları alt dizinlerle birlikte paralel listeler
+ * 
+ * @param dirName Kök dizin
+ * @param extension Dosya uzantısı (örn: ".txt")
+ * @param ordered 1: Yollar ağaç sırasıyla, 0: Bulundukları sırayla (daha hızlı)
+ * @return Başarı durumu
+ */
+ErrorCode listFilesByExtensionRecursive(const char* dirName, const char* extension, int ordered);
+
+/**
+ * Desenlerden birine uyan dosyaları listeler
+ * 
+ * @param dirName Dizin adı
+ * @param patterns Virgülle ayrılmış uzantı ve glob desenleri (örn: ".txt,.csv,rapor_*.log")
+ * @return Başarı durumu
+ */
+ErrorCode filterFiles(const char* dirName, const char* patterns);
+
+/**
+ * Desenlerden birine uyan dosyaları alt dizinlerle birlikte paralel listeler
+ * 
+ * @param dirName Kök dizin
+ * @param patterns Virgülle ayrılmış uzantı ve glob desenleri
+ * @param ordered 1: Yollar ağaç sırasıyla, 0: Bulundukları sırayla (daha hızlı)
+ * @return Başarı durumu
+ */
+ErrorCode filterFilesRecursive(const char* dirName, const char* patterns, int ordered);
+
+/**
+ * Dizin içeriğini çıktıya yazmadan her girdi için geri çağırma fonksiyonunu çağırır
+ * ("." ve ".." hariç). Fork yapmaz ve log kaydı tutmaz.
+ * 
+ * @param dirName Listelenecek dizinin adı
+ * @param callback Her girdi için çağrılacak fonksiyon
+ * @param userData Geri çağırma fonksiyonuna iletilecek veri
+ * @return Başarı durumu
+ */
+ErrorCode listDirEntries(const char* dirName, DirEntryCallback callback, void* userData);
+
+/**
+ * Belirtilen uzantıya sahip dosyaların her biri için geri çağırma fonksiyonunu çağırır.
+ * Fork yapmaz ve log kaydı tutmaz.
+ * 
+ * @param dirName Dizin adı
+ * @param extension Dosya uzantısı (örn: ".txt")
+ * @param callback Eşleşen her dosya için çağrılacak fonksiyon
+ * @param userData Geri çağırma fonksiyonuna iletilecek veri
+ * @return Başarı durumu
+ */
+ErrorCode listFilesByExtensionEntries(const char* dirName, const char* extension,
+                                      DirEntryCallback callback, void* userData);
+
+/**
+ * Derlenmiş desenlere uyan dosyaların her biri için geri çağırma fonksiyonunu çağırır.
+ * Fork yapmaz ve log kaydı tutmaz.
+ * 
+ * @param dirName Dizin adı
+ * @param matcher compileFileMatcher ile derlenmiş desenler
+ * @param callback Eşleşen her dosya için çağrılacak fonksiyon
+ * @param userData Geri çağırma fonksiyonuna iletilecek veri
+ * @return Başarı durumu
+ */
+ErrorCode filterFileEntries(const char* dirName, const FileMatcher* matcher,
+                            DirEntryCallback callback, void* userData);
+
+/**
+ * readdir girdisinin türünü belirler (gerekmedikçe stat yapmadan)
+ * 
+ * @param dirFd Girdinin bulunduğu dizinin tanımlayıcısı
+ * @param entry readdir girdisi
+ * @param isDir Girdi dizin mi (dizine işaret eden bağlantılar dahil)
+ * @return 1: Gerçek dizin (içine inilebilir), 0: Diğer
+ */
+int classifyDirEntry(int dirFd, const struct dirent* entry, int* isDir);
+
+/**
+ * Listeleme fonksiyonlarının şimdiye kadar yaptığı stat çağrısı sayısını döndürür.
+ * d_type sağlayan dosya sistemlerinde bu değer yalnızca sembolik bağlantılar için artar.
+ * 
+ * @return Bu işlemdeki toplam stat çağrısı sayısı
+ */
+unsigned long long getListingStatCount();
+
 /**
  * Dizini siler (sadece boş dizinler silinebilir)
  * 
@@ -41,6 +136,29 @@ ErrorCode listFilesByExtension(const char* dirName, const char* extension);
  */
 ErrorCode deleteDir(const char* dirName);
 
+/**
+ * Dizini içeriğiyle birlikte siler. Alt ağaçlar paralel ve aşağıdan yukarıya
+ * silinir; silinen dosya/dizin sayısı ve geçen süre çıktıya yazılır ve tek
+ * bir özet log kaydı tutulur.
+ * 
+ * @param dirName Silinecek dizinin adı (sembolik bağlantı olamaz)
+ * @return Başarı durumu (bir girdi bile silinemezse ERROR_UNKNOWN)
+ */
+ErrorCode deleteDirRecursive(const char* dirName);
+
+/**
+ * Dizini içeriğiyle birlikte paralel kopyalar. Dizinler bulundukça oluşturulur,
+ * dosyalar iş parçacığı havuzunda reflink/copy_file_range ile kopyalanır;
+ * izinler ve zamanlar korunur. Kopyalama sürerken saniyede bir ilerleme ve hız,
+ * sonunda özet çıktıya yazılır ve tek bir özet log kaydı tutulur.
+ * 
+ * @param source Kaynak dizin
+ * @param destination Oluşturulacak hedef dizin (mevcut olmamalı, kaynağın içinde olamaz)
+ * @param maxInFlightMb Aynı anda kopyalanan en fazla veri (MB, 0: varsayılan)
+ * @return Başarı durumu (bir girdi bile kopyalanamazsa ERROR_UNKNOWN)
+ */
+ErrorCode copyDir(const char* source, const char* destination, int maxInFlightMb);
+
 /**
  * Dizinin boş olup olmadığını kontrol eder
  * 
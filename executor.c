@@ -0,0 +1,141 @@
+/**
+ * executor.c
+ * Komut yönlendirme fonksiyonlarının implementasyonları
+ */
+
+#include "executor.h"
+#include "file_operations.h"
+#include "directory_operations.h"
+#include "content_search.h"
+#include "checksum.h"
+#include "logger.h"
+#include "utils.h"
+
+// Görevlerin fork ile ayrı işlemde çalıştırılması (--isolate)
+static int isolationMode = 0;
+
+/**
+ * Yalıtım modunu ayarlar
+ */
+void setIsolationMode(int enabled) {
+    isolationMode = enabled;
+}
+
+/**
+ * Yalıtım modunun açık olup olmadığını döndürür
+ */
+int getIsolationMode() {
+    return isolationMode;
+}
+
+/**
+ * Görevi aynı işlemde veya çocuk işlemde çalıştırır
+ */
+int runTask(TaskFunction task, void* arg) {
+    pid_t pid;
+    int status;
+    
+    if (!isolationMode) {
+        // Aynı işlem içinde çalıştır; dönüş değeri çıkış durumunun yerini tutar
+        return (task(arg) == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    
+    // Fork ile yeni bir işlem oluştur
+    pid = fork();
+    
+    if (pid < 0) {
+        return -1;
+    } else if (pid == 0) {
+        // Çocuk işlemi
+        exit(task(arg));
+    }
+    
+    // Ebeveyn işlemi
+    while (waitpid(pid, &status, 0) == -1) {
+        if (errno != EINTR) {
+            return EXIT_FAILURE;
+        }
+    }
+    
+    return (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * Komut türüne göre ilgili dosya/dizin işlemini çalıştırır
+ */
+ErrorCode executeCommand(const Command* cmd) {
+    if (cmd == NULL) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    switch (cmd->type) {
+        case CMD_CREATE_DIR:
+            return createDir(cmd->arg1);
+        case CMD_CREATE_FILE:
+            return createFile(cmd->arg1);
+        case CMD_LIST_DIR:
+            if (cmd->flags & CMD_FLAG_RECURSIVE) {
+                return listDirRecursive(cmd->arg1, !(cmd->flags & CMD_FLAG_UNORDERED));
+            }
+            return listDir(cmd->arg1);
+        case CMD_LIST_FILES_BY_EXTENSION:
+            if (cmd->flags & CMD_FLAG_RECURSIVE) {
+                return listFilesByExtensionRecursive(cmd->arg1, cmd->arg2, !(cmd->flags & CMD_FLAG_UNORDERED));
+            }
+            return listFilesByExtension(cmd->arg1, cmd->arg2);
+        case CMD_FILTER_FILES:
+            if (cmd->flags & CMD_FLAG_RECURSIVE) {
+                return filterFilesRecursive(cmd->arg1, cmd->arg2, !(cmd->flags & CMD_FLAG_UNORDERED));
+            }
+            return filterFiles(cmd->arg1, cmd->arg2);
+        case CMD_SEARCH_CONTENT:
+            return searchContent(cmd->arg1, cmd->arg2, (cmd->flags & CMD_FLAG_RECURSIVE) != 0, cmd->limit);
+        case CMD_READ_FILE:
+            if (cmd->flags & CMD_FLAG_FOLLOW) {
+                return followFile(cmd->arg1, (cmd->flags & CMD_FLAG_TAIL) ? cmd->limit : -1);
+            } else if (cmd->flags & CMD_FLAG_HEAD) {
+                return readFileHead(cmd->arg1, cmd->limit);
+            } else if (cmd->flags & CMD_FLAG_TAIL) {
+                return readFileTail(cmd->arg1, cmd->limit);
+            }
+            return readFileRange(cmd->arg1, cmd->offset, cmd->length);
+        case CMD_APPEND_TO_FILE:
+            if (cmd->flags & CMD_FLAG_STDIN) {
+                return appendStreamToFile(cmd->arg1, STDIN_FILENO);
+            }
+            if (cmd->flags & CMD_FLAG_FROM_FILE) {
+                return appendFileContents(cmd->arg1, cmd->arg2);
+            }
+            return appendToFile(cmd->arg1, cmd->content);
+        case CMD_COPY_FILE:
+            return copyFile(cmd->arg1, cmd->arg2);
+        case CMD_MOVE_FILE:
+            return moveFile(cmd->arg1, cmd->arg2);
+        case CMD_COPY_DIR:
+            return copyDir(cmd->arg1, cmd->arg2, cmd->limit);
+        case CMD_CHECKSUM:
+            return checksumFile(cmd->arg1, !(cmd->flags & CMD_FLAG_NO_CACHE));
+        case CMD_DELETE_FILE:
+            return deleteFile(cmd->arg1);
+        case CMD_DELETE_DIR:
+            if (cmd->flags & CMD_FLAG_RECURSIVE) {
+                return deleteDirRecursive(cmd->arg1);
+            }
+            return deleteDir(cmd->arg1);
+        case CMD_SHOW_LOGS: {
+            LogQuery query = { cmd->sinceNs, cmd->untilNs, cmd->logType, cmd->limit };
+            return showLogsQuery(&query);
+        }
+        case CMD_HELP:
+            showHelp();
+            return SUCCESS;
+        case CMD_BATCH:     // Toplu çalıştırma ve sunucu komutları iç içe kullanılamaz
+        case CMD_APPEND_BATCH:
+        case CMD_SERVE:
+        case CMD_CLIENT:
+        case CMD_LOGD:
+        case CMD_UNKNOWN:
+        default:
+            return ERROR_INVALID_ARGUMENT;
+    }
+}
@@ -0,0 +1,49 @@
+/**
+ * executor.h
+ * Ayrıştırılmış komutları ilgili işlemlere yönlendiren fonksiyon tanımlamaları
+ */
+
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include "file_system.h"
+
+/**
+ * İşlem gövdesi; çıkış durumu anlamında EXIT_SUCCESS veya EXIT_FAILURE döndürür
+ */
+typedef int (*TaskFunction)(void* arg);
+
+/**
+ * Görevlerin ayrı bir çocuk işlemde (fork) çalıştırılıp çalıştırılmayacağını ayarlar
+ * 
+ * @param enabled 1: Yalıtılmış (fork), 0: Aynı işlem içinde (varsayılan)
+ */
+void setIsolationMode(int enabled);
+
+/**
+ * Yalıtım modunun açık olup olmadığını döndürür
+ * 
+ * @return 1: Açık, 0: Kapalı
+ */
+int getIsolationMode();
+
+/**
+ * Görevi çalıştırır. Yalıtım kapalıysa görev aynı işlemde doğrudan çağrılır,
+ * açıksa çocuk işlemde çalıştırılıp waitpid ile beklenir. Her iki durumda da
+ * sonuç çıkış durumu olarak döner.
+ * 
+ * @param task Çalıştırılacak görev
+ * @param arg Göreve iletilecek argüman
+ * @return EXIT_SUCCESS / EXIT_FAILURE, çocuk işlem oluşturulamazsa -1
+ */
+int runTask(TaskFunction task, void* arg);
+
+/**
+ * Komut türüne göre ilgili dosya/dizin işlemini çalıştırır
+ * 
+ * @param cmd Çalıştırılacak komut
+ * @return Başarı durumu
+ */
+ErrorCode executeCommand(const Command* cmd);
+
+#endif /* EXECUTOR_H */
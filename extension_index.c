@@ -0,0 +1,430 @@
+/**
+ * extension_index.c
+ * Dizin başına kalıcı uzantı indeksinin implementasyonları
+ */
+
+#define _GNU_SOURCE
+#include "extension_index.h"
+#include "directory_operations.h"
+#include "utils.h"
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+
+/**
+ * İndeks oluşturulurken toplanan girdi (konumlar metin havuzunda)
+ */
+typedef struct {
+    uint32_t nameOffset;
+    uint32_t keyOffset;         // Adın son '.' ile başlayan son eki (yoksa ad sonundaki NUL)
+} IndexBuildEntry;
+
+/**
+ * mmap ile eşlenmiş indeks
+ */
+typedef struct {
+    void* data;
+    size_t size;
+    const ExtensionIndexHeader* header;
+    const ExtensionIndexKey* keys;
+    const uint32_t* names;
+    const char* strings;
+} MappedIndex;
+
+// listFilesByExtension indeksi kullanır mı (--index)
+static int indexEnabled = 0;
+
+// İndeks kullanım sayaçları (--stats)
+static unsigned long indexHits = 0;
+static unsigned long indexRebuilds = 0;
+
+/**
+ * Uzantı indeksini açar veya kapatır
+ */
+void setExtensionIndexEnabled(int enabled) {
+    indexEnabled = enabled;
+}
+
+/**
+ * Uzantı indeksinin açık olup olmadığını döndürür
+ */
+int isExtensionIndexEnabled() {
+    return indexEnabled;
+}
+
+/**
+ * İndeks kullanım sayaçlarını döndürür
+ */
+void getExtensionIndexStats(unsigned long* hits, unsigned long* rebuilds) {
+    *hits = __atomic_load_n(&indexHits, __ATOMIC_RELAXED);
+    *rebuilds = __atomic_load_n(&indexRebuilds, __ATOMIC_RELAXED);
+}
+
+/**
+ * Dizinin indeks dosyasının yolunu oluşturur
+ */
+static void getIndexPath(const struct stat* dirSt, char* buffer, size_t size) {
+    string_format(buffer, size, "%s/%lu-%lu.idx", EXTENSION_INDEX_DIR,
+                  (unsigned long)dirSt->st_dev, (unsigned long)dirSt->st_ino);
+}
+
+/**
+ * İndeks dosyasını eşler ve yapısını doğrular
+ * 
+ * @return 0: Başarılı, -1: Dosya yok veya bozuk
+ */
+static int mapIndex(const char* path, MappedIndex* index) {
+    struct stat st;
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    
+    if (fd == -1) {
+        return -1;
+    }
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(ExtensionIndexHeader)) {
+        close(fd);
+        return -1;
+    }
+    
+    index->size = (size_t)st.st_size;
+    index->data = mmap(NULL, index->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (index->data == MAP_FAILED) {
+        return -1;
+    }
+    
+    index->header = index->data;
+    index->keys = (const ExtensionIndexKey*)(index->header + 1);
+    index->names = (const uint32_t*)(index->keys + index->header->extensionCount);
+    index->strings = (const char*)(index->names + index->header->nameCount);
+    
+    const ExtensionIndexHeader* header = index->header;
+    size_t expected = sizeof(*header) + (size_t)header->extensionCount * sizeof(ExtensionIndexKey) +
+                      (size_t)header->nameCount * sizeof(uint32_t) + header->stringsSize;
+    if (header->magic != EXTENSION_INDEX_MAGIC || header->version != EXTENSION_INDEX_VERSION ||
+        expected != index->size || header->stringsSize == 0 ||
+        index->strings[header->stringsSize - 1] != '\0') {
+        munmap(index->data, index->size);
+        return -1;
+    }
+    
+    return 0;
+}
+
+static void unmapIndex(MappedIndex* index) {
+    munmap(index->data, index->size);
+}
+
+/**
+ * İndeksin dizinin güncel hali için geçerli olup olmadığını kontrol eder
+ */
+static int isIndexCurrent(const MappedIndex* index, const struct stat* dirSt) {
+    const ExtensionIndexHeader* header = index->header;
+    
+    // Oluşturma anına çok yakın değişiklikler aynı zaman damgası içinde
+    // kalmış olabileceğinden böyle bir indekse güvenilmez
+    return header->device == (uint64_t)dirSt->st_dev &&
+           header->inode == (uint64_t)dirSt->st_ino &&
+           header->mtimeNs == timespecToNs(&dirSt->st_mtim) &&
+           header->ctimeNs == timespecToNs(&dirSt->st_ctim) &&
+           header->builtNs - header->mtimeNs >= EXTENSION_INDEX_RACY_NS;
+}
+
+/**
+ * Uzantı tablosunda ikili arama
+ */
+static const ExtensionIndexKey* findIndexKey(const MappedIndex* index, const char* key) {
+    uint32_t lo = 0;
+    uint32_t hi = index->header->extensionCount;
+    
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        const ExtensionIndexKey* entry = &index->keys[mid];
+        if (entry->keyOffset >= index->header->stringsSize) {
+            return NULL;
+        }
+        int cmp = strcmp(index->strings + entry->keyOffset, key);
+        if (cmp == 0) {
+            return entry;
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * Adın indekste dizin olmayan bir girdi olarak bulunup bulunmadığını kontrol eder
+ */
+static int indexContainsName(const MappedIndex* index, const char* name) {
+    const char* dot = strrchr(name, '.');
+    const ExtensionIndexKey* key = findIndexKey(index, (dot != NULL) ? dot : "");
+    
+    if (key == NULL || (uint64_t)key->firstName + key->nameCount > index->header->nameCount) {
+        return 0;
+    }
+    
+    uint32_t lo = key->firstName;
+    uint32_t hi = key->firstName + key->nameCount;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (index->names[mid] >= index->header->stringsSize) {
+            return 0;
+        }
+        int cmp = strcmp(index->strings + index->names[mid], name);
+        if (cmp == 0) {
+            return 1;
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * Girdileri uzantıya, sonra ada göre sıralar
+ */
+static int compareBuildEntries(const void* a, const void* b, void* context) {
+    const char* strings = context;
+    const IndexBuildEntry* x = a;
+    const IndexBuildEntry* y = b;
+    
+    int cmp = strcmp(strings + x->keyOffset, strings + y->keyOffset);
+    return (cmp != 0) ? cmp : strcmp(strings + x->nameOffset, strings + y->nameOffset);
+}
+
+/**
+ * Dizini okuyup indeksi oluşturur ve yerine koyar. Önceki indeks verilirse
+ * türü d_type ile belirlenemeyen girdiler için stat yerine ona bakılır.
+ */
+static ErrorCode buildIndex(const char* dirName, const char* indexPath, const MappedIndex* previous) {
+    ExtensionIndexHeader header;
+    IndexBuildEntry* entries = NULL;
+    ExtensionIndexKey* keys = NULL;
+    uint32_t* names = NULL;
+    char* strings = NULL;
+    size_t count = 0;
+    size_t capacity = 0;
+    size_t stringsSize = 0;
+    size_t stringsCapacity = 0;
+    uint32_t keyCount = 0;
+    ErrorCode result = ERROR_UNKNOWN;
+    struct timespec now;
+    struct stat dirSt;
+    struct dirent* entry;
+    char tempPath[MAX_PATH_LENGTH];
+    
+    DIR* dir = opendir(dirName);
+    if (dir == NULL) {
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Zamanlar okumadan önce alınır; okuma sırasındaki değişiklikler
+    // dizinin mtime değerini kaydedilenden yeni yapar
+    clock_gettime(CLOCK_REALTIME, &now);
+    if (fstat(dirfd(dir), &dirSt) == -1) {
+        closedir(dir);
+        return ERROR_UNKNOWN;
+    }
+    
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.' &&
+            (entry->d_name[1] == '\0' || (entry->d_name[1] == '.' && entry->d_name[2] == '\0'))) {
+            continue;
+        }
+        
+        int isDir;
+        if ((entry->d_type == DT_UNKNOWN || entry->d_type == DT_LNK) &&
+            previous != NULL && indexContainsName(previous, entry->d_name)) {
+            isDir = 0;
+        } else {
+            classifyDirEntry(dirfd(dir), entry, &isDir);
+        }
+        if (isDir) {
+            continue;
+        }
+        
+        size_t nameLength = strlen(entry->d_name);
+        if (stringsSize + nameLength + 1 > stringsCapacity) {
+            size_t newCapacity = (stringsCapacity == 0) ? 65536 : stringsCapacity * 2;
+            while (newCapacity < stringsSize + nameLength + 1) {
+                newCapacity *= 2;
+            }
+            char* grown = realloc(strings, newCapacity);
+            if (grown == NULL) {
+                goto cleanup;
+            }
+            strings = grown;
+            stringsCapacity = newCapacity;
+        }
+        if (count == capacity) {
+            size_t newCapacity = (capacity == 0) ? 1024 : capacity * 2;
+            IndexBuildEntry* grown = realloc(entries, sizeof(IndexBuildEntry) * newCapacity);
+            if (grown == NULL) {
+                goto cleanup;
+            }
+            entries = grown;
+            capacity = newCapacity;
+        }
+        
+        const char* dot = strrchr(entry->d_name, '.');
+        entries[count].nameOffset = (uint32_t)stringsSize;
+        entries[count].keyOffset = (uint32_t)(stringsSize + ((dot != NULL) ? (size_t)(dot - entry->d_name) : nameLength));
+        memcpy(strings + stringsSize, entry->d_name, nameLength + 1);
+        stringsSize += nameLength + 1;
+        count++;
+    }
+    
+    // Boş dizinde de doğrulanabilir bir metin bölümü olsun
+    if (stringsSize == 0) {
+        strings = malloc(1);
+        if (strings == NULL) {
+            goto cleanup;
+        }
+        strings[0] = '\0';
+        stringsSize = 1;
+    }
+    
+    qsort_r(entries, count, sizeof(IndexBuildEntry), compareBuildEntries, strings);
+    
+    // Uzantı tablosu ve ad konumları
+    keys = malloc(sizeof(ExtensionIndexKey) * (count + 1));
+    names = malloc(sizeof(uint32_t) * (count + 1));
+    if (keys == NULL || names == NULL) {
+        goto cleanup;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (keyCount == 0 || strcmp(strings + keys[keyCount - 1].keyOffset, strings + entries[i].keyOffset) != 0) {
+            keys[keyCount].keyOffset = entries[i].keyOffset;
+            keys[keyCount].firstName = (uint32_t)i;
+            keys[keyCount].nameCount = 0;
+            keys[keyCount].reserved = 0;
+            keyCount++;
+        }
+        keys[keyCount - 1].nameCount++;
+        names[i] = entries[i].nameOffset;
+    }
+    
+    memset(&header, 0, sizeof(header));
+    header.magic = EXTENSION_INDEX_MAGIC;
+    header.version = EXTENSION_INDEX_VERSION;
+    header.device = (uint64_t)dirSt.st_dev;
+    header.inode = (uint64_t)dirSt.st_ino;
+    header.mtimeNs = timespecToNs(&dirSt.st_mtim);
+    header.ctimeNs = timespecToNs(&dirSt.st_ctim);
+    header.builtNs = timespecToNs(&now);
+    header.extensionCount = keyCount;
+    header.nameCount = (uint32_t)count;
+    header.stringsSize = (uint32_t)stringsSize;
+    
+    // Geçici dosyaya yaz ve yerine taşı; eski indeksi eşlemiş okuyucular etkilenmez
+    string_format(tempPath, sizeof(tempPath), "%s.XXXXXX", indexPath);
+    int fd = mkstemp(tempPath);
+    if (fd == -1) {
+        goto cleanup;
+    }
+    
+    struct iovec iov[4] = {
+        { &header, sizeof(header) },
+        { keys, sizeof(ExtensionIndexKey) * keyCount },
+        { names, sizeof(uint32_t) * count },
+        { strings, stringsSize }
+    };
+    size_t total = iov[0].iov_len + iov[1].iov_len + iov[2].iov_len + iov[3].iov_len;
+    ssize_t written = writev(fd, iov, 4);
+    fchmod(fd, 0644);
+    close(fd);
+    
+    if (written != (ssize_t)total || rename(tempPath, indexPath) == -1) {
+        unlink(tempPath);
+        goto cleanup;
+    }
+    result = SUCCESS;
+    
+cleanup:
+    closedir(dir);
+    free(entries);
+    free(keys);
+    free(names);
+    free(strings);
+    return result;
+}
+
+/**
+ * Uzantıya uyan dosyaları indeksten iletir
+ */
+ErrorCode queryExtensionIndex(const char* dirName, const char* extension,
+                              DirEntryCallback callback, void* userData, int* handled) {
+    MappedIndex index;
+    struct stat dirSt;
+    char indexPath[MAX_PATH_LENGTH];
+    
+    *handled = 0;
+    
+    // İndeks son '.' ile başlayan son eke göre gruplanır
+    const char* key = strrchr(extension, '.');
+    if (key == NULL) {
+        return SUCCESS;
+    }
+    
+    // Hatalar tarama yolunda raporlanır
+    if (stat(dirName, &dirSt) == -1 || !S_ISDIR(dirSt.st_mode)) {
+        return SUCCESS;
+    }
+    
+    getIndexPath(&dirSt, indexPath, sizeof(indexPath));
+    int mapped = (mapIndex(indexPath, &index) == 0);
+    
+    if (mapped && isIndexCurrent(&index, &dirSt)) {
+        __atomic_add_fetch(&indexHits, 1, __ATOMIC_RELAXED);
+    } else {
+        if (mkdir(EXTENSION_INDEX_DIR, 0755) == -1 && errno != EEXIST) {
+            if (mapped) {
+                unmapIndex(&index);
+            }
+            return SUCCESS;
+        }
+        
+        ErrorCode result = buildIndex(dirName, indexPath, mapped ? &index : NULL);
+        if (mapped) {
+            unmapIndex(&index);
+        }
+        if (result != SUCCESS || mapIndex(indexPath, &index) != 0) {
+            return SUCCESS;
+        }
+        __atomic_add_fetch(&indexRebuilds, 1, __ATOMIC_RELAXED);
+    }
+    
+    const ExtensionIndexKey* group = findIndexKey(&index, key);
+    if (group != NULL && (uint64_t)group->firstName + group->nameCount <= index.header->nameCount) {
+        size_t extLen = strlen(extension);
+        
+        for (uint32_t i = 0; i < group->nameCount; i++) {
+            uint32_t offset = index.names[group->firstName + i];
+            if (offset >= index.header->stringsSize) {
+                break;
+            }
+            
+            // Çok noktalı uzantılarda (".tar.gz") grup içinde son ek karşılaştırılır
+            const char* name = index.strings + offset;
+            size_t nameLen = strlen(name);
+            if (nameLen <= extLen || (key != extension && strcmp(name + nameLen - extLen, extension) != 0)) {
+                continue;
+            }
+            if (callback(name, 0, userData) != 0) {
+                break;
+            }
+        }
+    }
+    
+    unmapIndex(&index);
+    *handled = 1;
+    return SUCCESS;
+}
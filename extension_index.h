@@ -0,0 +1,87 @@
+/**
+ * extension_index.h
+ * Dizin başına kalıcı uzantı indeksi için fonksiyon tanımlamaları
+ *
+ * İndeks, dizindeki dizin olmayan girdileri son '.' ile başlayan uzantıya
+ * göre gruplanmış ve sıralanmış olarak tutan, mmap ile okunan bir dosyadır.
+ * Dizinin kendisine yazılmaz (mtime değişirdi); EXTENSION_INDEX_DIR altında
+ * aygıt ve düğüm numarasıyla adlandırılır ve dizinin mtime/ctime değerleriyle
+ * doğrulanır. Değişmemiş bir dizinde sorgu bir stat ve bir mmap aramasıdır.
+ */
+
+#ifndef EXTENSION_INDEX_H
+#define EXTENSION_INDEX_H
+
+#include "file_system.h"
+#include <stdint.h>
+
+#define EXTENSION_INDEX_DIR ".file_system_index"
+#define EXTENSION_INDEX_MAGIC 0x58444946u   // "FIDX"
+#define EXTENSION_INDEX_VERSION 1
+#define EXTENSION_INDEX_RACY_NS 1000000000LL    // Bu süreden yeni değişiklikler güvenilmez
+
+/**
+ * İndeks dosyası başlığı; ardından uzantı tablosu, ad konumları ve metinler gelir
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t device;
+    uint64_t inode;
+    int64_t mtimeNs;            // İndeks oluşturulurken dizinin mtime değeri
+    int64_t ctimeNs;            // İndeks oluşturulurken dizinin ctime değeri
+    int64_t builtNs;            // İndeksin oluşturulma zamanı
+    uint32_t extensionCount;
+    uint32_t nameCount;
+    uint32_t stringsSize;
+    uint32_t reserved;
+} ExtensionIndexHeader;
+
+/**
+ * Uzantı tablosu girdisi (uzantıya göre sıralı)
+ */
+typedef struct {
+    uint32_t keyOffset;         // Uzantı metni (".txt", uzantısızlar için "")
+    uint32_t firstName;         // Ad konumları dizisindeki ilk ad
+    uint32_t nameCount;         // Bu uzantıdaki ad sayısı (sıralı)
+    uint32_t reserved;
+} ExtensionIndexKey;
+
+/**
+ * Uzantı indeksini açar veya kapatır (--index)
+ * 
+ * @param enabled 1: listFilesByExtension indeksi kullanır
+ */
+void setExtensionIndexEnabled(int enabled);
+
+/**
+ * Uzantı indeksinin açık olup olmadığını döndürür
+ * 
+ * @return 1: Açık, 0: Kapalı
+ */
+int isExtensionIndexEnabled();
+
+/**
+ * Uzantıya uyan dosyaları indeksten iletir; indeks yoksa veya eskiyse önce
+ * yeniden oluşturulur. Son '.' dışında başka nokta içeren uzantılar indeksin
+ * gruplarından süzülerek, nokta içermeyen uzantılar hiç yanıtlanmaz.
+ * 
+ * @param dirName Dizin adı
+ * @param extension Dosya uzantısı (örn: ".txt")
+ * @param callback Eşleşen her dosya için çağrılacak fonksiyon
+ * @param userData Geri çağırma fonksiyonuna iletilecek veri
+ * @param handled 1: Sorgu indeksten yanıtlandı, 0: Çağıran dizini taramalı
+ * @return Başarı durumu
+ */
+ErrorCode queryExtensionIndex(const char* dirName, const char* extension,
+                              DirEntryCallback callback, void* userData, int* handled);
+
+/**
+ * İndeks kullanım sayaçlarını döndürür
+ * 
+ * @param hits Geçerli indeksten yanıtlanan sorgu sayısı
+ * @param rebuilds İndeksin (yeniden) oluşturulduğu sorgu sayısı
+ */
+void getExtensionIndexStats(unsigned long* hits, unsigned long* rebuilds);
+
+#endif /* EXTENSION_INDEX_H */
@@ -0,0 +1,574 @@
+/**
+ * file_matcher.c
+ * Dosya adı desenleri için eşleştiricinin implementasyonları
+ */
+
+#include "file_matcher.h"
+#include <stdint.h>
+
+#define GLOB_ITEM_SET 0         // Karakter kümesinden tek karakter
+#define GLOB_ITEM_STAR 1        // Herhangi bir dizi
+#define GLOB_ITEM_END 2         // Desenin sonu (kabul)
+
+#define POSITION_WORDS (FILE_MATCHER_MAX_POSITIONS / 64)
+
+/**
+ * Son ek kümesi girdisi
+ */
+typedef struct {
+    uint64_t key;               // 8 bayta kadar son eklerde baytların kendisi, daha uzunlarda özeti
+    uint32_t length;            // 0: Boş yuva
+    uint32_t minNameLength;     // Eşleşme için gereken en kısa ad (".txt" için 5, "*.txt" için 4)
+    const char* text;
+} SuffixEntry;
+
+/**
+ * Glob desenlerinin öğe dizisi (tüm desenler art arda)
+ */
+typedef struct {
+    int count;
+    uint8_t kinds[FILE_MATCHER_MAX_POSITIONS];
+    uint8_t sets[FILE_MATCHER_MAX_POSITIONS][32];
+    int startCount;
+    int starts[FILE_MATCHER_MAX_POSITIONS];
+} GlobProgram;
+
+/**
+ * DFA durumu olarak konum kümesi
+ */
+typedef struct {
+    uint64_t bits[POSITION_WORDS];
+} PositionSet;
+
+struct FileMatcher {
+    // Son ek kümesi (açık adresleme)
+    SuffixEntry* suffixes;
+    uint32_t suffixMask;        // Tablo boyutu - 1
+    uint32_t lengthCount;
+    uint32_t* lengths;          // Farklı son ek uzunlukları (artan)
+    char* text;                 // Desen metinlerinin kopyası
+    
+    // Glob DFA (stateCount == 0: glob yok). 0: ölü durum, 1: başlangıç
+    uint32_t stateCount;
+    uint32_t classCount;
+    uint8_t classOf[256];
+    uint16_t* transitions;
+    uint8_t* accepting;
+};
+
+/**
+ * Adın son 8 baytını (kısa adlarda sağa hizalayıp sıfırla doldurarak) okur
+ */
+static inline uint64_t loadTail(const char* name, size_t length) {
+    uint64_t word = 0;
+    
+    if (length >= 8) {
+        memcpy(&word, name + length - 8, 8);
+    } else {
+        char buffer[8] = { 0 };
+        memcpy(buffer + 8 - length, name, length);
+        memcpy(&word, buffer, 8);
+    }
+    
+    return word;
+}
+
+/**
+ * loadTail ile okunan sözcükten son length baytı ayırır; karşılaştırma
+ * bayt bayt yapılmak yerine tek tamsayı işlemiyle yapılır (SWAR)
+ */
+static inline uint64_t extractTail(uint64_t word, uint32_t length) {
+    if (length >= 8) {
+        return word;
+    }
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return word >> (64 - 8 * length);
+#else
+    return word & ((1ULL << (8 * length)) - 1);
+#endif
+}
+
+static uint64_t hashBytes(const char* data, size_t length) {
+    uint64_t hash = 1469598103934665603ULL;
+    
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)data[i]) * 1099511628211ULL;
+    }
+    
+    return hash;
+}
+
+static inline uint32_t suffixSlot(uint64_t key, uint32_t length, uint32_t mask) {
+    uint64_t hash = (key ^ ((uint64_t)length << 56)) * 0x9E3779B97F4A7C15ULL;
+    return (uint32_t)(hash >> 32) & mask;
+}
+
+/**
+ * Son eki adın sonundan okunacağı biçimde anahtara çevirir
+ */
+static uint64_t suffixKey(const char* text, uint32_t length) {
+    return (length <= 8) ? extractTail(loadTail(text, length), length) : hashBytes(text, length);
+}
+
+/**
+ * Son eki kümeye ekler; aynı son ek varsa daha gevşek ad sınırı kalır
+ */
+static void addSuffix(FileMatcher* matcher, const char* text, uint32_t length, uint32_t minNameLength) {
+    uint64_t key = suffixKey(text, length);
+    uint32_t slot = suffixSlot(key, length, matcher->suffixMask);
+    
+    while (matcher->suffixes[slot].length != 0) {
+        SuffixEntry* entry = &matcher->suffixes[slot];
+        if (entry->length == length && entry->key == key && memcmp(entry->text, text, length) == 0) {
+            if (minNameLength < entry->minNameLength) {
+                entry->minNameLength = minNameLength;
+            }
+            return;
+        }
+        slot = (slot + 1) & matcher->suffixMask;
+    }
+    
+    matcher->suffixes[slot].key = key;
+    matcher->suffixes[slot].length = length;
+    matcher->suffixes[slot].minNameLength = minNameLength;
+    matcher->suffixes[slot].text = text;
+    
+    // Uzunluklar artan sırada tutulur; kısa addan uzun son ekler denenmez
+    uint32_t i = matcher->lengthCount;
+    for (uint32_t j = 0; j < matcher->lengthCount; j++) {
+        if (matcher->lengths[j] == length) {
+            return;
+        }
+    }
+    while (i > 0 && matcher->lengths[i - 1] > length) {
+        matcher->lengths[i] = matcher->lengths[i - 1];
+        i--;
+    }
+    matcher->lengths[i] = length;
+    matcher->lengthCount++;
+}
+
+static int isGlobSpecial(char c) {
+    return c == '*' || c == '?' || c == '[' || c == '\\';
+}
+
+static int hasGlobSpecial(const char* text, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (isGlobSpecial(text[i])) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static inline void setByte(uint8_t* set, unsigned char c) {
+    set[c >> 3] |= (uint8_t)(1u << (c & 7));
+}
+
+static inline int hasByte(const uint8_t* set, unsigned char c) {
+    return (set[c >> 3] >> (c & 7)) & 1;
+}
+
+/**
+ * "[...]" karakter sınıfını okur
+ * 
+ * @return Sınıftan sonraki konum, kapanmamış sınıfta -1
+ */
+static long parseCharClass(const char* pattern, size_t length, size_t start, uint8_t* set) {
+    size_t i = start + 1;
+    int negate = 0;
+    int first = 1;
+    
+    memset(set, 0, 32);
+    if (i < length && (pattern[i] == '!' || pattern[i] == '^')) {
+        negate = 1;
+        i++;
+    }
+    
+    while (i < length && (pattern[i] != ']' || first)) {
+        unsigned char low = (unsigned char)pattern[i];
+        if (low == '\\' && i + 1 < length) {
+            low = (unsigned char)pattern[++i];
+        }
+        i++;
+        
+        unsigned char high = low;
+        if (i + 1 < length && pattern[i] == '-' && pattern[i + 1] != ']') {
+            i++;
+            if (pattern[i] == '\\' && i + 1 < length) {
+                i++;
+            }
+            high = (unsigned char)pattern[i++];
+        }
+        for (unsigned int c = low; c <= high; c++) {
+            setByte(set, (unsigned char)c);
+        }
+        first = 0;
+    }
+    
+    if (i >= length) {
+        return -1;
+    }
+    if (negate) {
+        for (int b = 0; b < 32; b++) {
+            set[b] = (uint8_t)~set[b];
+        }
+    }
+    
+    return (long)i + 1;
+}
+
+/**
+ * Glob desenini öğelere çevirip programa ekler
+ * 
+ * @return 0: Başarılı, -1: Konum sınırı aşıldı
+ */
+static int addGlob(GlobProgram* program, const char* pattern, size_t length) {
+    size_t i = 0;
+    
+    program->starts[program->startCount++] = program->count;
+    
+    while (i < length) {
+        // Sona kabul öğesi için yer kalmalı
+        if (program->count >= FILE_MATCHER_MAX_POSITIONS - 1) {
+            return -1;
+        }
+        
+        int index = program->count;
+        uint8_t* set = program->sets[index];
+        char c = pattern[i];
+        long next;
+        
+        if (c == '*') {
+            i++;
+            // Art arda yıldızlar tek yıldızdır
+            if (index > program->starts[program->startCount - 1] && program->kinds[index - 1] == GLOB_ITEM_STAR) {
+                continue;
+            }
+            program->kinds[index] = GLOB_ITEM_STAR;
+            program->count++;
+            continue;
+        }
+        
+        program->kinds[index] = GLOB_ITEM_SET;
+        memset(set, 0, 32);
+        if (c == '?') {
+            memset(set, 0xFF, 32);
+            i++;
+        } else if (c == '[' && (next = parseCharClass(pattern, length, i, set)) > 0) {
+            i = (size_t)next;
+        } else {
+            // Kapanmamış '[' düz karakterdir
+            memset(set, 0, 32);
+            if (c == '\\' && i + 1 < length) {
+                i++;
+            }
+            setByte(set, (unsigned char)pattern[i]);
+            i++;
+        }
+        program->count++;
+    }
+    
+    program->kinds[program->count++] = GLOB_ITEM_END;
+    return 0;
+}
+
+static inline void addPosition(PositionSet* set, int position) {
+    set->bits[position >> 6] |= 1ULL << (position & 63);
+}
+
+static inline int hasPosition(const PositionSet* set, int position) {
+    return (set->bits[position >> 6] >> (position & 63)) & 1;
+}
+
+/**
+ * Yıldızların boş diziyle geçilebildiği konumları ekler
+ */
+static void closePositions(const GlobProgram* program, PositionSet* set) {
+    for (int i = 0; i < program->count; i++) {
+        if (hasPosition(set, i) && program->kinds[i] == GLOB_ITEM_STAR) {
+            addPosition(set, i + 1);
+        }
+    }
+}
+
+/**
+ * Konum kümesinin c karakterinden sonraki halini hesaplar
+ */
+static void stepPositions(const GlobProgram* program, const PositionSet* from, unsigned char c, PositionSet* to) {
+    memset(to, 0, sizeof(*to));
+    
+    for (int i = 0; i < program->count; i++) {
+        if (!hasPosition(from, i)) {
+            continue;
+        }
+        if (program->kinds[i] == GLOB_ITEM_STAR) {
+            addPosition(to, i);
+        } else if (program->kinds[i] == GLOB_ITEM_SET && hasByte(program->sets[i], c)) {
+            addPosition(to, i + 1);
+        }
+    }
+    
+    closePositions(program, to);
+}
+
+static uint32_t hashPositions(const PositionSet* set) {
+    uint64_t hash = 0;
+    
+    for (int i = 0; i < POSITION_WORDS; i++) {
+        hash = (hash ^ set->bits[i]) * 0x9E3779B97F4A7C15ULL;
+    }
+    
+    return (uint32_t)(hash >> 32);
+}
+
+/**
+ * Glob programını alt küme yöntemiyle DFA'ya çevirir
+ * 
+ * @return 0: Başarılı, -1: Bellek yetersiz veya durum sınırı aşıldı
+ */
+static int buildGlobDfa(FileMatcher* matcher, const GlobProgram* program) {
+    const uint32_t tableSize = FILE_MATCHER_MAX_STATES * 2;
+    unsigned char representative[256];
+    int remap[512];
+    int result = -1;
+    
+    // Hiçbir kümenin ayırt etmediği karakterler aynı sınıfa düşer
+    memset(matcher->classOf, 0, sizeof(matcher->classOf));
+    matcher->classCount = 1;
+    for (int i = 0; i < program->count; i++) {
+        if (program->kinds[i] != GLOB_ITEM_SET) {
+            continue;
+        }
+        uint32_t newCount = 0;
+        for (int k = 0; k < 512; k++) {
+            remap[k] = -1;
+        }
+        for (int c = 0; c < 256; c++) {
+            int key = matcher->classOf[c] * 2 + hasByte(program->sets[i], (unsigned char)c);
+            if (remap[key] < 0) {
+                remap[key] = (int)newCount++;
+            }
+            matcher->classOf[c] = (uint8_t)remap[key];
+        }
+        matcher->classCount = newCount;
+    }
+    for (int c = 255; c >= 0; c--) {
+        representative[matcher->classOf[c]] = (unsigned char)c;
+    }
+    
+    PositionSet* states = malloc(sizeof(PositionSet) * FILE_MATCHER_MAX_STATES);
+    int32_t* table = malloc(sizeof(int32_t) * tableSize);
+    matcher->transitions = malloc(sizeof(uint16_t) * FILE_MATCHER_MAX_STATES * matcher->classCount);
+    matcher->accepting = calloc(FILE_MATCHER_MAX_STATES, 1);
+    if (states == NULL || table == NULL || matcher->transitions == NULL || matcher->accepting == NULL) {
+        goto cleanup;
+    }
+    for (uint32_t i = 0; i < tableSize; i++) {
+        table[i] = -1;
+    }
+    
+    // 0: ölü durum (boş küme), 1: başlangıç
+    memset(&states[0], 0, sizeof(PositionSet));
+    memset(&states[1], 0, sizeof(PositionSet));
+    for (int i = 0; i < program->startCount; i++) {
+        addPosition(&states[1], program->starts[i]);
+    }
+    closePositions(program, &states[1]);
+    for (uint32_t s = 0; s < 2; s++) {
+        uint32_t slot = hashPositions(&states[s]) & (tableSize - 1);
+        while (table[slot] >= 0) {
+            slot = (slot + 1) & (tableSize - 1);
+        }
+        table[slot] = (int32_t)s;
+    }
+    matcher->stateCount = 2;
+    for (uint32_t c = 0; c < matcher->classCount; c++) {
+        matcher->transitions[c] = 0;
+    }
+    
+    for (uint32_t s = 1; s < matcher->stateCount; s++) {
+        for (int i = 0; i < program->count; i++) {
+            if (program->kinds[i] == GLOB_ITEM_END && hasPosition(&states[s], i)) {
+                matcher->accepting[s] = 1;
+                break;
+            }
+        }
+        
+        for (uint32_t c = 0; c < matcher->classCount; c++) {
+            PositionSet next;
+            stepPositions(program, &states[s], representative[c], &next);
+            
+            uint32_t slot = hashPositions(&next) & (tableSize - 1);
+            int32_t target = -1;
+            while (table[slot] >= 0) {
+                if (memcmp(&states[table[slot]], &next, sizeof(next)) == 0) {
+                    target = table[slot];
+                    break;
+                }
+                slot = (slot + 1) & (tableSize - 1);
+            }
+            if (target < 0) {
+                if (matcher->stateCount == FILE_MATCHER_MAX_STATES) {
+                    goto cleanup;
+                }
+                target = (int32_t)matcher->stateCount++;
+                states[target] = next;
+                table[slot] = target;
+            }
+            matcher->transitions[s * matcher->classCount + c] = (uint16_t)target;
+        }
+    }
+    result = 0;
+    
+cleanup:
+    free(states);
+    free(table);
+    return result;
+}
+
+/**
+ * Desen listesini derler
+ */
+ErrorCode compileFileMatcher(const char* patterns, FileMatcher** matcher) {
+    GlobProgram* program;
+    FileMatcher* compiled;
+    size_t patternsLength;
+    uint32_t tableSize = 16;
+    
+    if (patterns == NULL || matcher == NULL) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    patternsLength = strlen(patterns);
+    while (tableSize < patternsLength * 2) {
+        tableSize *= 2;
+    }
+    
+    compiled = calloc(1, sizeof(FileMatcher));
+    program = malloc(sizeof(GlobProgram));
+    if (compiled == NULL || program == NULL) {
+        free(compiled);
+        free(program);
+        return ERROR_UNKNOWN;
+    }
+    program->count = 0;
+    program->startCount = 0;
+    
+    compiled->text = strdup(patterns);
+    compiled->suffixes = calloc(tableSize, sizeof(SuffixEntry));
+    compiled->lengths = malloc(sizeof(uint32_t) * (patternsLength + 1));
+    compiled->suffixMask = tableSize - 1;
+    if (compiled->text == NULL || compiled->suffixes == NULL || compiled->lengths == NULL) {
+        free(program);
+        freeFileMatcher(compiled);
+        return ERROR_UNKNOWN;
+    }
+    
+    int patternCount = 0;
+    const char* cursor = compiled->text;
+    while (*cursor != '\0') {
+        const char* end = strchr(cursor, ',');
+        size_t length = (end != NULL) ? (size_t)(end - cursor) : strlen(cursor);
+        
+        if (length > 0) {
+            patternCount++;
+            if (cursor[0] == '.' && !hasGlobSpecial(cursor, length)) {
+                // Uzantı: listFilesByExtension gibi addan kısa olmalı
+                addSuffix(compiled, cursor, (uint32_t)length, (uint32_t)length + 1);
+            } else if (cursor[0] == '*' && length > 1 && !hasGlobSpecial(cursor + 1, length - 1)) {
+                // "*son_ek": yıldız boş diziyle de eşleşir
+                addSuffix(compiled, cursor + 1, (uint32_t)length - 1, (uint32_t)length - 1);
+            } else if (addGlob(program, cursor, length) != 0) {
+                free(program);
+                freeFileMatcher(compiled);
+                return ERROR_INVALID_ARGUMENT;
+            }
+        }
+        
+        cursor += length + (end != NULL);
+    }
+    
+    if (patternCount == 0 || (program->startCount > 0 && buildGlobDfa(compiled, program) != 0)) {
+        free(program);
+        freeFileMatcher(compiled);
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    free(program);
+    *matcher = compiled;
+    return SUCCESS;
+}
+
+/**
+ * Adın son ek kümesindeki bir son eke uyup uymadığını kontrol eder
+ */
+static int matchSuffix(const FileMatcher* matcher, const char* name, size_t nameLength) {
+    uint64_t tail = loadTail(name, nameLength);
+    
+    for (uint32_t i = 0; i < matcher->lengthCount; i++) {
+        uint32_t length = matcher->lengths[i];
+        if (length > nameLength) {
+            break;
+        }
+        
+        const char* suffix = name + nameLength - length;
+        uint64_t key = (length <= 8) ? extractTail(tail, length) : hashBytes(suffix, length);
+        uint32_t slot = suffixSlot(key, length, matcher->suffixMask);
+        
+        while (matcher->suffixes[slot].length != 0) {
+            const SuffixEntry* entry = &matcher->suffixes[slot];
+            if (entry->length == length && entry->key == key &&
+                (length <= 8 || memcmp(entry->text, suffix, length) == 0)) {
+                if (nameLength >= entry->minNameLength) {
+                    return 1;
+                }
+                break;
+            }
+            slot = (slot + 1) & matcher->suffixMask;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * Dosya adının desenlerden birine uyup uymadığını kontrol eder
+ */
+int matchFileName(const FileMatcher* matcher, const char* name, size_t nameLength) {
+    if (matcher->lengthCount > 0 && matchSuffix(matcher, name, nameLength)) {
+        return 1;
+    }
+    
+    if (matcher->stateCount == 0) {
+        return 0;
+    }
+    
+    const uint16_t* transitions = matcher->transitions;
+    uint32_t classCount = matcher->classCount;
+    uint32_t state = 1;
+    for (size_t i = 0; i < nameLength; i++) {
+        state = transitions[state * classCount + matcher->classOf[(unsigned char)name[i]]];
+        if (state == 0) {
+            return 0;
+        }
+    }
+    
+    return matcher->accepting[state];
+}
+
+/**
+ * Eşleştiriciyi bırakır
+ */
+void freeFileMatcher(FileMatcher* matcher) {
+    if (matcher == NULL) {
+        return;
+    }
+    
+    free(matcher->suffixes);
+    free(matcher->lengths);
+    free(matcher->text);
+    free(matcher->transitions);
+    free(matcher->accepting);
+    free(matcher);
+}
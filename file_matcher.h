@@ -0,0 +1,52 @@
+/**
+ * file_matcher.h
+ * Dosya adı desenleri (uzantı kümesi ve glob) için eşleştirici tanımlamaları
+ *
+ * Virgülle ayrılmış desenler bir kez derlenir. Joker içermeyen ve '.' ile
+ * başlayan desenler (".txt") ile "*" ve ardından düz metinden oluşan
+ * desenler ("*_yedek") son ek kümesine, diğerleri ("rapor_2026-*.csv",
+ * "[a-c]?.log") tek bir DFA'ya derlenir. Böylece her ad, desen sayısından
+ * bağımsız olarak bir son ek araması ve tek bir DFA geçişiyle eşleştirilir.
+ */
+
+#ifndef FILE_MATCHER_H
+#define FILE_MATCHER_H
+
+#include "file_system.h"
+
+#define FILE_MATCHER_MAX_POSITIONS 256     // Tüm glob desenlerindeki toplam öğe sayısı
+#define FILE_MATCHER_MAX_STATES 4096       // DFA durum sınırı
+
+typedef struct FileMatcher FileMatcher;
+
+/**
+ * Desen listesini derler
+ * 
+ * Glob sözdizimi: '*' (herhangi bir dizi), '?' (tek karakter), "[a-z]" ve
+ * "[!a-z]" (karakter sınıfı), '\' (sonraki karakteri düz al).
+ * 
+ * @param patterns Virgülle ayrılmış desenler (örn: ".txt,.csv,rapor_*.log")
+ * @param matcher Derlenen eşleştirici (freeFileMatcher ile bırakılır)
+ * @return Başarı durumu (boş veya çok karmaşık desende ERROR_INVALID_ARGUMENT)
+ */
+ErrorCode compileFileMatcher(const char* patterns, FileMatcher** matcher);
+
+/**
+ * Dosya adının desenlerden birine uyup uymadığını kontrol eder.
+ * Eşleştirici değiştirilmediğinden iş parçacıklarından eşzamanlı çağrılabilir.
+ * 
+ * @param matcher Derlenmiş eşleştirici
+ * @param name Dosya adı (yol değil)
+ * @param nameLength Adın uzunluğu
+ * @return 1: Uyuyor, 0: Uymuyor
+ */
+int matchFileName(const FileMatcher* matcher, const char* name, size_t nameLength);
+
+/**
+ * Eşleştiriciyi bırakır
+ * 
+ * @param matcher Derlenmiş eşleştirici (NULL olabilir)
+ */
+void freeFileMatcher(FileMatcher* matcher);
+
+#endif /* FILE_MATCHER_H */
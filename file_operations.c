@@ -3,29 +3,282 @@
  * Dosya işlemleri için fonksiyon implementasyonları
  */
 
+#define _GNU_SOURCE
 #include "file_operations.h"
 #include "logger.h"
 #include "utils.h"
+#include "executor.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/fs.h>
+#include <poll.h>
+#include <stdio.h>
+#include <sys/inotify.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+#include <sys/uio.h>
+
+#define STREAM_CHUNK_SIZE (4 * 1024 * 1024)
+#define STREAM_BUFFER_SIZE (1024 * 1024)
+#define STREAM_BUFFER_ALIGNMENT 4096
+#define LINE_SCAN_WINDOW (1024 * 1024)
+#define READ_SEQUENTIAL_HINT_SIZE (1024 * 1024)
+#define FOLLOW_EVENT_BUFFER_SIZE 4096
+
+// Okuyan/yazanların kilitleme biçimi (--lock-mode)
+static LockMode lockMode = LOCK_MODE_EXCLUSIVE;
+
+// Çekirdek OFD kilitlerini desteklemiyorsa klasik kayıt kilitleri kullanılır
+static int ofdLocksUnsupported = 0;
+
+// Kilit alma süre sınırı (--lock-timeout, ms; -1: sınırsız)
+static int lockTimeoutMs = -1;
+
+// Kilit bekleme istatistikleri (--stats)
+static LockStats lockStats;
+
+// İş parçacığının son kilit beklemesi (işlemin log kaydı için)
+static __thread unsigned long long lastLockWaitNs = 0;
 
 /**
- * Dosyayı kilitleme işlemi
+ * Kilitleme modunu ayarlar
  */
-ErrorCode lockFile(int fd) {
+void setLockMode(LockMode mode) {
+    lockMode = mode;
+}
+
+/**
+ * Kilitleme modunu döndürür
+ */
+LockMode getLockMode() {
+    return lockMode;
+}
+
+/**
+ * Kilit alma süresini sınırlar
+ */
+void setLockTimeout(int timeoutMs) {
+    lockTimeoutMs = timeoutMs;
+}
+
+/**
+ * Kilit alma süre sınırını döndürür
+ */
+int getLockTimeout() {
+    return lockTimeoutMs;
+}
+
+/**
+ * Çağıran iş parçacığının son kilit beklemesini döndürür
+ */
+unsigned long long getLastLockWait() {
+    return lastLockWaitNs;
+}
+
+/**
+ * Kilit bekleme istatistiklerini döndürür
+ */
+void getLockStats(LockStats* stats) {
+    stats->acquisitions = __atomic_load_n(&lockStats.acquisitions, __ATOMIC_RELAXED);
+    stats->timeouts = __atomic_load_n(&lockStats.timeouts, __ATOMIC_RELAXED);
+    stats->totalWaitNs = __atomic_load_n(&lockStats.totalWaitNs, __ATOMIC_RELAXED);
+    stats->maxWaitNs = __atomic_load_n(&lockStats.maxWaitNs, __ATOMIC_RELAXED);
+}
+
+static long long monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * Bekleme süresini istatistiklere ekler
+ */
+static void recordLockWait(unsigned long long waitNs, int acquired) {
+    lastLockWaitNs = waitNs;
+    __atomic_add_fetch(acquired ? &lockStats.acquisitions : &lockStats.timeouts, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&lockStats.totalWaitNs, waitNs, __ATOMIC_RELAXED);
+    
+    unsigned long long max = __atomic_load_n(&lockStats.maxWaitNs, __ATOMIC_RELAXED);
+    while (waitNs > max &&
+           !__atomic_compare_exchange_n(&lockStats.maxWaitNs, &max, waitNs, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+/**
+ * fcntl kilit isteğini OFD kilidi olarak, desteklenmiyorsa klasik olarak uygular
+ */
+static int applyFileLock(int fd, int wait, struct flock* fl) {
+    if (!__atomic_load_n(&ofdLocksUnsupported, __ATOMIC_RELAXED)) {
+        fl->l_pid = 0;  // OFD kilitlerinde zorunlu
+        int rc;
+        while ((rc = fcntl(fd, wait ? F_OFD_SETLKW : F_OFD_SETLK, fl)) == -1 && errno == EINTR) {
+        }
+        if (rc == 0 || errno != EINVAL) {
+            return rc;
+        }
+        __atomic_store_n(&ofdLocksUnsupported, 1, __ATOMIC_RELAXED);
+    }
+    
+    fl->l_pid = getpid();
+    int rc;
+    while ((rc = fcntl(fd, wait ? F_SETLKW : F_SETLK, fl)) == -1 && errno == EINTR) {
+    }
+    return rc;
+}
+
+/**
+ * Dosyanın bir aralığını kilitler
+ */
+ErrorCode lockFileRange(int fd, short type, off_t start, off_t length) {
     struct flock fl;
     
-    fl.l_type = F_WRLCK;  // Yazma kilidi
+    int rc;
+    int lockErrno = 0;
+    
+    fl.l_type = type;
     fl.l_whence = SEEK_SET;
-    fl.l_start = 0;
-    fl.l_len = 0;  // Tüm dosyayı kilitle
-    fl.l_pid = getpid();
+    fl.l_start = start;
+    fl.l_len = length;
     
-    if (fcntl(fd, F_SETLKW, &fl) == -1) {
-        return ERROR_PERMISSION_DENIED;
+    long long begin = monotonicNs();
+    long long now = begin;
+    
+    if (lockTimeoutMs < 0) {
+        rc = applyFileLock(fd, 1, &fl);
+        lockErrno = errno;
+        now = monotonicNs();
+    } else {
+        // Süre dolana kadar beklemeyi ikiye katlayarak yeniden dene; aynı anda
+        // bekleyenler aynı anda uyanmasın diye bekleme biraz rastgeleleştirilir
+        long long deadline = begin + (long long)lockTimeoutMs * 1000000LL;
+        long backoffUs = LOCK_BACKOFF_MIN_US;
+        
+        for (;;) {
+            rc = applyFileLock(fd, 0, &fl);
+            lockErrno = errno;
+            now = monotonicNs();
+            if (rc == 0 || (lockErrno != EAGAIN && lockErrno != EACCES) || now >= deadline) {
+                break;
+            }
+            
+            long long sleepNs = (backoffUs / 2 + now % (backoffUs / 2 + 1)) * 1000LL;
+            if (sleepNs > deadline - now) {
+                sleepNs = deadline - now;
+            }
+            struct timespec pause = { (time_t)(sleepNs / 1000000000LL), (long)(sleepNs % 1000000000LL) };
+            nanosleep(&pause, NULL);
+            
+            backoffUs = (backoffUs * 2 > LOCK_BACKOFF_MAX_US) ? LOCK_BACKOFF_MAX_US : backoffUs * 2;
+        }
+    }
+    
+    int timedOut = (rc == -1 && (lockErrno == EAGAIN || lockErrno == EACCES));
+    if (rc == 0 || timedOut) {
+        recordLockWait((unsigned long long)(now - begin), rc == 0);
+    }
+    if (rc == -1) {
+        return timedOut ? ERROR_LOCK_TIMEOUT : ERROR_PERMISSION_DENIED;
+    }
+    
+    return SUCCESS;
+}
+
+/**
+ * Kilit alınamadıysa nedenini loglar
+ */
+static void logLockFailure(const char* fileName, ErrorCode result) {
+    char logMsg[MAX_PATH_LENGTH + 100];
+    
+    if (result == ERROR_LOCK_TIMEOUT) {
+        string_format(logMsg, sizeof(logMsg), "%s (%d ms)", fileName, lockTimeoutMs);
+        logEvent(LOG_ERROR, OP_LOCK_TIMEOUT, logMsg);
+    } else if (result == ERROR_FILE_NOT_FOUND) {
+        logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, fileName);
+    }
+}
+
+/**
+ * İşlemin başarı kaydını tutar; kilit için uzun beklendiyse süre de yazılır
+ */
+static void logWithLockWait(LogOperation operation, const char* text) {
+    char logMsg[MAX_PATH_LENGTH + 200];
+    
+    if (lastLockWaitNs >= LOCK_WAIT_LOG_THRESHOLD_NS) {
+        string_format(logMsg, sizeof(logMsg), "%s (kilit bekleme %llu us)", text, lastLockWaitNs / 1000);
+        logEvent(LOG_INFO, operation, logMsg);
+    } else {
+        logEvent(LOG_INFO, operation, text);
     }
+}
+
+/**
+ * Aralığı beklemeden kilitlemeyi dener
+ */
+static ErrorCode tryLockFileRange(int fd, short type, off_t start, off_t length) {
+    struct flock fl;
+    
+    fl.l_type = type;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = start;
+    fl.l_len = length;
     
+    if (applyFileLock(fd, 0, &fl) == -1) {
+        return (errno == EAGAIN || errno == EACCES) ? ERROR_LOCK_TIMEOUT : ERROR_PERMISSION_DENIED;
+    }
+    recordLockWait(0, 1);
     return SUCCESS;
 }
 
+/**
+ * Ekleme kilidini alır; wait 0 ise kilit başkasındayken beklemez
+ */
+static ErrorCode lockForAppend(int fd, int wait) {
+    struct stat st;
+    off_t start = 0;
+    ErrorCode result;
+    
+    if (lockMode == LOCK_MODE_SHARED) {
+        if (fstat(fd, &st) == -1) {
+            return ERROR_UNKNOWN;
+        }
+        // Kilit alınana kadar başka ekleyenler dosyayı büyütebilir; bölge sonsuza
+        // uzandığından yeni dosya sonu da kilidin içinde kalır
+        start = st.st_size;
+    }
+    result = wait ? lockFileRange(fd, F_WRLCK, start, 0) : tryLockFileRange(fd, F_WRLCK, start, 0);
+    
+    // Kilit beklenirken dosya taşındı veya silindiyse eklenen veri kaybolurdu
+    if (result == SUCCESS && fstat(fd, &st) == 0 && st.st_nlink == 0) {
+        unlockFile(fd);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    return result;
+}
+
+/**
+ * Dosyaya ekleme için kilit alır
+ */
+ErrorCode lockFileForAppend(int fd) {
+    return lockForAppend(fd, 1);
+}
+
+/**
+ * Dosyaya ekleme kilidini beklemeden almayı dener
+ */
+ErrorCode tryLockFileForAppend(int fd) {
+    return lockForAppend(fd, 0);
+}
+
+/**
+ * Dosyayı kilitleme işlemi
+ */
+ErrorCode lockFile(int fd) {
+    // Tüm dosyayı yazma kilidiyle kilitle
+    return lockFileRange(fd, F_WRLCK, 0, 0);
+}
+
 /**
  * Dosya kilidini açma işlemi
  */
@@ -36,9 +289,8 @@ ErrorCode unlockFile(int fd) {
     fl.l_whence = SEEK_SET;
     fl.l_start = 0;
     fl.l_len = 0;
-    fl.l_pid = getpid();
     
-    if (fcntl(fd, F_SETLK, &fl) == -1) {
+    if (applyFileLock(fd, 0, &fl) == -1) {
         return ERROR_PERMISSION_DENIED;
     }
     
@@ -50,29 +302,35 @@ ErrorCode unlockFile(int fd) {
  */
 ErrorCode createFile(const char* fileName) {
     int fd;
-    char logMsg[MAX_PATH_LENGTH + 50];
-    char timeBuffer[50];
-    ErrorCode result;
     
     // Dosyanın zaten var olup olmadığını kontrol et
     if (fileExists(fileName)) {
-        string_format(logMsg, sizeof(logMsg), "Dosya zaten mevcut: %s", fileName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_FILE_EXISTS, fileName);
         return ERROR_FILE_EXISTS;
     }
     
     // Dosyayı oluştur
     fd = open(fileName, O_WRONLY | O_CREAT | O_EXCL, 0644); // 0644 dosya sahibinin okuyup yazabildiği, diğerlerinin ise sadece okuyabildiği bir izin seviyesi belirtir.
     if (fd == -1) {
-        string_format(logMsg, sizeof(logMsg), "Dosya oluşturma hatası: %s", fileName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_FILE_CREATE_ERROR, fileName);
         return ERROR_UNKNOWN;
     }
     
+    return stampCreatedFile(fd, fileName);
+}
+
+/**
+ * Yeni oluşturulan dosyaya oluşturulma zamanını yazar ve dosyayı kapatır
+ */
+ErrorCode stampCreatedFile(int fd, const char* fileName) {
+    char timeBuffer[50];
+    ErrorCode result;
+    
     // Dosyayı kilitle
     result = lockFile(fd);
     if (result != SUCCESS) {
         close(fd);
+        logLockFailure(fileName, result);
         return result;
     }
     
@@ -84,8 +342,7 @@ ErrorCode createFile(const char* fileName) {
     if (write(fd, content, strlen(content)) == -1) {
         unlockFile(fd);
         close(fd);
-        string_format(logMsg, sizeof(logMsg), "Dosyaya yazma hatası: %s", fileName);
-        logMessage(LOG_ERROR, logMsg);
+        logEvent(LOG_ERROR, OP_FILE_WRITE_ERROR, fileName);
         return ERROR_UNKNOWN;
     }
     
@@ -94,171 +351,1254 @@ ErrorCode createFile(const char* fileName) {
     close(fd);
     
     // Log mesajı oluştur
-    string_format(logMsg, sizeof(logMsg), "Dosya oluşturuldu: %s", fileName);
-    logMessage(LOG_INFO, logMsg);
+    logWithLockWait(OP_FILE_CREATED, fileName);
     
     return SUCCESS;
 }
 
 /**
- * Dosya içeriğini okur
+ * Dosya içeriğini parça parça geri çağırma fonksiyonuna iletir
  */
-ErrorCode readFile(const char* fileName) {
+ErrorCode readFileChunks(const char* fileName, DataChunkCallback callback, void* userData) {
     int fd;
     char buffer[MAX_CONTENT_LENGTH];
     ssize_t bytesRead;
-    char logMsg[MAX_PATH_LENGTH + 50];
-    pid_t pid;
     
-    // Dosyanın mevcut olup olmadığını kontrol et
-    if (!fileExists(fileName)) {
-        string_format(logMsg, sizeof(logMsg), "Dosya bulunamadı: %s", fileName);
-        logMessage(LOG_ERROR, logMsg);
-        return ERROR_FILE_NOT_FOUND;
+    if (fileName == NULL || callback == NULL) {
+        return ERROR_INVALID_ARGUMENT;
     }
     
     // Dosyayı aç
     fd = open(fileName, O_RDONLY);
     if (fd == -1) {
-        string_format(logMsg, sizeof(logMsg), "Dosya açma hatası: %s", fileName);
-        logMessage(LOG_ERROR, logMsg);
-        return ERROR_UNKNOWN;
+        if (errno == EACCES) {
+            return ERROR_PERMISSION_DENIED;
+        }
+        return (errno == ENOENT) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
     }
     
-    // Child process oluştur
-    pid = fork();
+    // Paylaşımlı modda okuma süresince eklemeler beklenir (yarım kayıt görülmez)
+    if (lockMode == LOCK_MODE_SHARED) {
+        ErrorCode result = lockFileRange(fd, F_RDLCK, 0, 0);
+        if (result != SUCCESS) {
+            close(fd);
+            return result;
+        }
+    }
     
-    if (pid == -1) {
-        close(fd);
-        return ERROR_UNKNOWN;
-    } else if (pid == 0) {
-        // Child process - dosyayı oku
-        const char* header = "\n--- Dosya İçeriği ---\n";
-        write(STDOUT_FILENO, header, strlen(header));
-        
-        while ((bytesRead = read(fd, buffer, sizeof(buffer) - 1)) > 0) {
-            buffer[bytesRead] = '\0';
-            write(STDOUT_FILENO, buffer, bytesRead);
+    while ((bytesRead = read(fd, buffer, sizeof(buffer))) > 0) {
+        if (callback(buffer, (size_t)bytesRead, userData) != 0) {
+            break;
         }
-        
-        const char* footer = "\n--------------------\n";
-        write(STDOUT_FILENO, footer, strlen(footer));
-        
-        close(fd);
-        exit(EXIT_SUCCESS);
-    } else {
-        // Ana process - child'ın tamamlanmasını bekle
-        int status;
-        waitpid(pid, &status, 0);
-        close(fd);
     }
     
-    // Log mesajı oluştur
-    string_format(logMsg, sizeof(logMsg), "Dosya okundu: %s", fileName);
-    logMessage(LOG_INFO, logMsg);
+    if (lockMode == LOCK_MODE_SHARED) {
+        unlockFile(fd);
+    }
+    close(fd);
+    return (bytesRead < 0) ? ERROR_UNKNOWN : SUCCESS;
+}
+
+/**
+ * readFileToBuffer için hedef buffer durumu
+ */
+typedef struct {
+    char* buffer;
+    size_t size;
+    size_t used;
+} BufferSink;
+
+/**
+ * Okunan parçayı çağıranın buffer'ına kopyalar
+ */
+static int copyToBuffer(const char* data, size_t length, void* userData) {
+    BufferSink* sink = userData;
+    size_t space = sink->size - sink->used;
     
-    return SUCCESS;
+    if (length > space) {
+        length = space;
+    }
+    memcpy(sink->buffer + sink->used, data, length);
+    sink->used += length;
+    
+    // Buffer dolduysa okumayı durdur
+    return sink->used == sink->size;
 }
 
 /**
- * Dosyaya içerik ekleme
+ * Dosya içeriğini çağıranın verdiği buffer'a okur
  */
-ErrorCode appendToFile(const char* fileName, const char* content) {
-    int fd;
-    char logMsg[MAX_PATH_LENGTH + 50];
+ErrorCode readFileToBuffer(const char* fileName, char* buffer, size_t size, size_t* bytesRead) {
+    BufferSink sink = { buffer, size, 0 };
     ErrorCode result;
     
-    // Dosyanın mevcut olup olmadığını kontrol et
-    if (!fileExists(fileName)) {
-        string_format(logMsg, sizeof(logMsg), "Dosya bulunamadı: %s", fileName);
-        logMessage(LOG_ERROR, logMsg);
-        return ERROR_FILE_NOT_FOUND;
+    if (buffer == NULL || bytesRead == NULL) {
+        return ERROR_INVALID_ARGUMENT;
     }
     
-    // Dosyayı aç
-    fd = open(fileName, O_WRONLY | O_APPEND);
-    if (fd == -1) {
-        string_format(logMsg, sizeof(logMsg), "Dosya açma hatası: %s", fileName);
-        logMessage(LOG_ERROR, logMsg);
-        return ERROR_UNKNOWN;
+    *bytesRead = 0;
+    if (size == 0) {
+        return SUCCESS;
     }
     
-    // Dosyayı kilitle
-    result = lockFile(fd);
-    if (result != SUCCESS) {
-        close(fd);
-        return result;
+    result = readFileChunks(fileName, copyToBuffer, &sink);
+    *bytesRead = sink.used;
+    
+    return result;
+}
+
+/**
+ * Bloklamayan tanımlayıcı yazılabilir olana kadar bekler; EAGAIN alan
+ * döngüler işlemciyi boşa döndürmez
+ * 
+ * @return 0: Yazılabilir, -1: Hata
+ */
+static int waitWritable(int fd) {
+    struct pollfd pfd = { .fd = fd, .events = POLLOUT };
+    int rc;
+    
+    while ((rc = poll(&pfd, 1, -1)) == -1 && errno == EINTR) {
+    }
+    return (rc == 1 && !(pfd.revents & (POLLERR | POLLNVAL))) ? 0 : -1;
+}
+
+/**
+ * Verinin tamamını yazar (kısmi yazmaları yönetir)
+ */
+static int writeAll(int fd, const char* data, size_t length) {
+    while (length > 0) {
+        ssize_t written = write(fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR || (errno == EAGAIN && waitWritable(fd) == 0)) {
+                continue;
+            }
+            return -1;
+        }
+        data += written;
+        length -= (size_t)written;
     }
     
-    // İçeriği dosyaya yaz
-    if (write(fd, content, strlen(content)) == -1) {
-        unlockFile(fd);
-        close(fd);
-        string_format(logMsg, sizeof(logMsg), "Dosyaya yazma hatası: %s", fileName);
-        logMessage(LOG_ERROR, logMsg);
+    return 0;
+}
+
+/**
+ * iovec dizisinin tamamını yazar (kısmi yazmaları yönetir)
+ * 
+ * @param offset Yazma konumu (-1: dosyanın mevcut konumu)
+ * @return 0: Başarılı, -1: Hata
+ */
+static int writevAll(int fd, struct iovec* iov, int count, off_t offset) {
+    while (count > 0) {
+        ssize_t written = (offset < 0) ? writev(fd, iov, count) : pwritev(fd, iov, count, offset);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (offset >= 0) {
+            offset += written;
+        }
+        
+        // Tamamen yazılan parçaları atla, yarım kalanı kısalt
+        while (count > 0 && (size_t)written >= iov->iov_len) {
+            written -= (ssize_t)iov->iov_len;
+            iov++;
+            count--;
+        }
+        if (count > 0) {
+            iov->iov_base = (char*)iov->iov_base + written;
+            iov->iov_len -= (size_t)written;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * Açık bir dosyanın aralığını verilen tanımlayıcıya kopyalar
+ */
+ErrorCode streamFileRange(int inFd, int outFd, off_t offset, off_t length) {
+    // Toplam taşarsa aralık dosya sonuna kadar sayılır
+    off_t end = (length > (off_t)LLONG_MAX - offset) ? (off_t)LLONG_MAX : offset + length;
+    
+    // 1) sendfile: veri kullanıcı alanına hiç kopyalanmaz
+    while (offset < end) {
+        size_t chunk = (end - offset > STREAM_CHUNK_SIZE) ? STREAM_CHUNK_SIZE : (size_t)(end - offset);
+        ssize_t sent = sendfile(outFd, inFd, &offset, chunk);
+        if (sent > 0) {
+            continue;
+        }
+        if (sent == 0) {
+            return SUCCESS;  // Dosya beklenenden kısa
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno == EAGAIN) {
+            if (waitWritable(outFd) == -1) {
+                return ERROR_UNKNOWN;
+            }
+            continue;
+        }
+        if (errno == EINVAL || errno == ENOSYS) {
+            break;  // Bu hedef için desteklenmiyor
+        }
         return ERROR_UNKNOWN;
     }
     
-    // Yeni satır ekle
-    const char newline = '\n';
-    if (write(fd, &newline, 1) == -1) {
-        unlockFile(fd);
-        close(fd);
+    // 2) splice: hedef bir pipe ise
+    while (offset < end) {
+        size_t chunk = (end - offset > STREAM_CHUNK_SIZE) ? STREAM_CHUNK_SIZE : (size_t)(end - offset);
+        ssize_t moved = splice(inFd, &offset, outFd, NULL, chunk, SPLICE_F_MORE);
+        if (moved > 0) {
+            continue;
+        }
+        if (moved == 0) {
+            return SUCCESS;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno == EAGAIN) {
+            if (waitWritable(outFd) == -1) {
+                return ERROR_UNKNOWN;
+            }
+            continue;
+        }
+        if (errno == EINVAL || errno == ENOSYS) {
+            break;
+        }
         return ERROR_UNKNOWN;
     }
     
-    // Kilidi kaldır ve dosyayı kapat
-    unlockFile(fd);
-    close(fd);
+    if (offset >= end) {
+        return SUCCESS;
+    }
     
-    // Log mesajı oluştur
-    string_format(logMsg, sizeof(logMsg), "Dosyaya içerik eklendi: %s", fileName);
-    logMessage(LOG_INFO, logMsg);
+    // 3) Büyük, sayfa hizalı buffer ile pread/write
+    void* buffer;
+    if (posix_memalign(&buffer, STREAM_BUFFER_ALIGNMENT, STREAM_BUFFER_SIZE) != 0) {
+        return ERROR_UNKNOWN;
+    }
     
-    return SUCCESS;
+    ErrorCode result = SUCCESS;
+    while (offset < end) {
+        size_t chunk = (end - offset > STREAM_BUFFER_SIZE) ? STREAM_BUFFER_SIZE : (size_t)(end - offset);
+        ssize_t bytesRead = pread(inFd, buffer, chunk, offset);
+        if (bytesRead < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result = ERROR_UNKNOWN;
+            break;
+        }
+        if (bytesRead == 0) {
+            break;
+        }
+        if (writeAll(outFd, buffer, (size_t)bytesRead) == -1) {
+            result = ERROR_UNKNOWN;
+            break;
+        }
+        offset += bytesRead;
+    }
+    
+    free(buffer);
+    return result;
 }
 
 /**
- * Dosya silme
+ * Dosyanın hangi kısmının okunacağı
  */
-ErrorCode deleteFile(const char* fileName) {
-    char logMsg[MAX_PATH_LENGTH + 50];
-    pid_t pid;
+typedef enum {
+    READ_SELECTION_RANGE,   // Bayt aralığı
+    READ_SELECTION_HEAD,    // İlk N satır
+    READ_SELECTION_TAIL     // Son N satır
+} ReadSelection;
+
+/**
+ * Dosyanın başından itibaren ilk N satırın bayt uzunluğunu bulur. Dosya
+ * pencereler halinde eşlenir ve yalnızca N. satır sonuna kadar taranır.
+ * 
+ * @return Uzunluk, eşleme başarısızsa -1
+ */
+static long long findHeadLength(int fd, long long size, long long lines) {
+    long long position = 0;
     
-    // Dosyanın mevcut olup olmadığını kontrol et
-    if (!fileExists(fileName)) {
-        string_format(logMsg, sizeof(logMsg), "Dosya bulunamadı: %s", fileName);
-        logMessage(LOG_ERROR, logMsg);
-        return ERROR_FILE_NOT_FOUND;
+    while (position < size && lines > 0) {
+        size_t window = (size - position > LINE_SCAN_WINDOW) ? LINE_SCAN_WINDOW : (size_t)(size - position);
+        char* map = mmap(NULL, window, PROT_READ, MAP_PRIVATE, fd, (off_t)position);
+        if (map == MAP_FAILED) {
+            return -1;
+        }
+        madvise(map, window, MADV_SEQUENTIAL);
+        
+        const char* p = map;
+        const char* end = map + window;
+        while (lines > 0 && (p = memchr(p, '\n', (size_t)(end - p))) != NULL) {
+            p++;
+            lines--;
+        }
+        
+        long long scanned = (lines == 0) ? (long long)(p - map) : (long long)window;
+        munmap(map, window);
+        position += scanned;
     }
     
-    // Child process oluştur
-    pid = fork();
+    return position;
+}
+
+/**
+ * Son N satırın başladığı konumu dosyanın sonundan geriye doğru tarayarak
+ * bulur. Dosyanın sonundaki yeni satır son satıra aittir.
+ * 
+ * @return Başlangıç konumu, eşleme başarısızsa -1
+ */
+static long long findTailOffset(int fd, long long size, long long lines) {
+    long long pageSize = sysconf(_SC_PAGESIZE);
+    long long end = size;
+    int skipFinalNewline = 1;
+    
+    if (lines == 0) {
+        return size;
+    }
     
-    if (pid == -1) {
-        string_format(logMsg, sizeof(logMsg), "Fork hatası: %s", fileName);
-        logMessage(LOG_ERROR, logMsg);
-        return ERROR_UNKNOWN;
-    } else if (pid == 0) {
-        // Child process - dosyayı sil
-        if (unlink(fileName) == -1) {
-            exit(EXIT_FAILURE);
+    while (end > 0) {
+        // Pencere başı sayfa sınırına hizalanır
+        long long start = (end > LINE_SCAN_WINDOW) ? end - LINE_SCAN_WINDOW : 0;
+        start -= start % pageSize;
+        size_t window = (size_t)(end - start);
+        
+        char* map = mmap(NULL, window, PROT_READ, MAP_PRIVATE, fd, (off_t)start);
+        if (map == MAP_FAILED) {
+            return -1;
         }
-        exit(EXIT_SUCCESS);
-    } else {
-        // Ana process - child'ın tamamlanmasını bekle
-        int status;
-        waitpid(pid, &status, 0);
+        madvise(map, window, MADV_WILLNEED);
         
-        if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) {
-            // Log mesajı oluştur
-            string_format(logMsg, sizeof(logMsg), "Dosya silindi: %s", fileName);
-            logMessage(LOG_INFO, logMsg);
-            return SUCCESS;
-        } else {
-            string_format(logMsg, sizeof(logMsg), "Dosya silme hatası: %s", fileName);
-            logMessage(LOG_ERROR, logMsg);
-            return ERROR_UNKNOWN;
+        size_t remaining = window;
+        if (skipFinalNewline) {
+            if (map[remaining - 1] == '\n') {
+                remaining--;
+            }
+            skipFinalNewline = 0;
+        }
+        
+        const char* p;
+        while ((p = memrchr(map, '\n', remaining)) != NULL) {
+            if (--lines == 0) {
+                long long offset = start + (long long)(p - map) + 1;
+                munmap(map, window);
+                return offset;
+            }
+            remaining = (size_t)(p - map);
         }
+        
+        munmap(map, window);
+        end = start;
+    }
+    
+    return 0;
+}
+
+/**
+ * Dosyanın seçilen kısmını okur ve çıktıya aktarır
+ */
+static ErrorCode readFileSelection(const char* fileName, ReadSelection selection,
+                                   long long offset, long long length, long long lines) {
+    int fd;
+    struct stat st;
+    char logMsg[MAX_PATH_LENGTH + 100];
+    ErrorCode result;
+    
+    if (offset < 0 || length < -1 || lines < 0) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    // Dosyanın mevcut olup olmadığını kontrol et
+    if (!fileExists(fileName)) {
+        logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, fileName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Dosyayı aç
+    fd = open(fileName, O_RDONLY);
+    if (fd == -1) {
+        logEvent(LOG_ERROR, OP_FILE_OPEN_ERROR, fileName);
+        return ERROR_UNKNOWN;
+    }
+    
+    // Paylaşımlı modda okunan aralık kilitlenir: okuyanlar birbirini beklemez,
+    // dosya sonuna kadar okuyanlar devam eden eklemenin bitmesini bekler.
+    // Boyut kilit alındıktan sonra okunur. Satır sınırları ancak dosya
+    // okununca belli olduğundan satır seçimlerinde tüm dosya kilitlenir.
+    int locked = (lockMode == LOCK_MODE_SHARED);
+    if (locked) {
+        result = (selection == READ_SELECTION_RANGE)
+            ? lockFileRange(fd, F_RDLCK, (off_t)offset, (length == -1 || length > LLONG_MAX - offset) ? 0 : (off_t)length)
+            : lockFileRange(fd, F_RDLCK, 0, 0);
+        if (result != SUCCESS) {
+            close(fd);
+            logLockFailure(fileName, result);
+            return result;
+        }
+    }
+    if (fstat(fd, &st) == -1) {
+        close(fd);
+        logEvent(LOG_ERROR, OP_FILE_OPEN_ERROR, fileName);
+        return ERROR_UNKNOWN;
+    }
+    
+    // Satır seçimini bayt aralığına çevir
+    if (selection != READ_SELECTION_RANGE && st.st_size > 0) {
+        if (selection == READ_SELECTION_HEAD) {
+            length = findHeadLength(fd, st.st_size, lines);
+        } else {
+            offset = findTailOffset(fd, st.st_size, lines);
+            length = (offset >= 0) ? st.st_size - offset : -1;
+        }
+        if (offset < 0 || length < 0) {
+            if (locked) {
+                unlockFile(fd);
+            }
+            close(fd);
+            logEvent(LOG_ERROR, OP_FILE_READ_ERROR, fileName);
+            return ERROR_UNKNOWN;
+        }
+    }
+    
+    // Aralığı dosya boyutuna göre sınırla
+    if (offset > st.st_size) {
+        if (locked) {
+            unlockFile(fd);
+        }
+        close(fd);
+        logEvent(LOG_ERROR, OP_FILE_RANGE_ERROR, fileName);
+        return ERROR_INVALID_ARGUMENT;
+    }
+    if (length == -1 || length > st.st_size - offset) {
+        length = st.st_size - offset;
+    }
+    
+    // Büyük aralıklarda çekirdeğin önden okuma penceresini büyüt
+    if (length >= READ_SEQUENTIAL_HINT_SIZE) {
+        posix_fadvise(fd, (off_t)offset, (off_t)length, POSIX_FADV_SEQUENTIAL);
+    }
+    
+    const char* header = "\n--- Dosya İçeriği ---\n";
+    write(getOutputFd(), header, strlen(header));
+    
+    result = streamFileRange(fd, getOutputFd(), (off_t)offset, (off_t)length);
+    
+    const char* footer = "\n--------------------\n";
+    write(getOutputFd(), footer, strlen(footer));
+    
+    if (locked) {
+        unlockFile(fd);
+    }
+    close(fd);
+    
+    if (result != SUCCESS) {
+        logEvent(LOG_ERROR, OP_FILE_READ_ERROR, fileName);
+        return result;
+    }
+    
+    // Log mesajı oluştur
+    if (selection == READ_SELECTION_HEAD) {
+        string_format(logMsg, sizeof(logMsg), "%s (ilk %lld satır)", fileName, lines);
+        logEvent(LOG_INFO, OP_FILE_READ, logMsg);
+    } else if (selection == READ_SELECTION_TAIL) {
+        string_format(logMsg, sizeof(logMsg), "%s (son %lld satır)", fileName, lines);
+        logEvent(LOG_INFO, OP_FILE_READ, logMsg);
+    } else if (offset == 0 && offset + length == st.st_size) {
+        logEvent(LOG_INFO, OP_FILE_READ, fileName);
+    } else {
+        string_format(logMsg, sizeof(logMsg), "%s (aralık %lld:%lld)", fileName, offset, length);
+        logEvent(LOG_INFO, OP_FILE_READ, logMsg);
+    }
+    
+    return SUCCESS;
+}
+
+/**
+ * Dosyanın bir aralığını okur
+ */
+ErrorCode readFileRange(const char* fileName, long long offset, long long length) {
+    return readFileSelection(fileName, READ_SELECTION_RANGE, offset, length, 0);
+}
+
+/**
+ * Dosyanın ilk satırlarını okur
+ */
+ErrorCode readFileHead(const char* fileName, long long lines) {
+    return readFileSelection(fileName, READ_SELECTION_HEAD, 0, -1, lines);
+}
+
+/**
+ * Dosyanın son satırlarını okur
+ */
+ErrorCode readFileTail(const char* fileName, long long lines) {
+    return readFileSelection(fileName, READ_SELECTION_TAIL, 0, -1, lines);
+}
+
+/**
+ * Takip edilen dosyanın son yazılan konumdan sonrasını çıktıya yazar
+ * 
+ * @param offset Son yazılan konum; yazılan kadar ilerletilir
+ * @param deleted Dosyanın tüm bağlantıları silindiyse 1 yapılır
+ * @return Başarı durumu
+ */
+static ErrorCode writeFollowedRange(int fd, const char* fileName, long long* offset, int* deleted) {
+    struct stat st;
+    ErrorCode result = SUCCESS;
+    
+    // Paylaşımlı modda devam eden ekleme bitene kadar beklenir; yarım kayıt yazılmaz
+    int locked = (lockMode == LOCK_MODE_SHARED);
+    if (locked) {
+        result = lockFileRange(fd, F_RDLCK, (off_t)*offset, 0);
+        if (result != SUCCESS) {
+            return result;
+        }
+    }
+    
+    if (fstat(fd, &st) == -1) {
+        result = ERROR_UNKNOWN;
+    } else {
+        if (st.st_size < *offset) {
+            // Dosya kısaltıldı, baştan devam edilir
+            char msg[MAX_PATH_LENGTH + 50];
+            int len = string_format(msg, sizeof(msg), "readFile: dosya kısaltıldı: %s\n", fileName);
+            write(STDERR_FILENO, msg, len);
+            *offset = 0;
+        }
+        if (st.st_size > *offset) {
+            result = streamFileRange(fd, getOutputFd(), (off_t)*offset, (off_t)(st.st_size - *offset));
+            *offset = st.st_size;
+        }
+        *deleted = (st.st_nlink == 0);
+    }
+    
+    if (locked) {
+        unlockFile(fd);
+    }
+    return result;
+}
+
+/**
+ * Dosyayı yeni eklenenleri yazarak takip eder
+ */
+ErrorCode followFile(const char* fileName, long long tailLines) {
+    char events[FOLLOW_EVENT_BUFFER_SIZE] __attribute__((aligned(__alignof__(struct inotify_event))));
+    char logMsg[MAX_PATH_LENGTH + 100];
+    struct stat st;
+    long long offset = 0;
+    int deleted = 0;
+    int fd;
+    int watchFd;
+    ErrorCode result;
+    
+    // Dosyanın mevcut olup olmadığını kontrol et
+    if (!fileExists(fileName)) {
+        logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, fileName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    fd = open(fileName, O_RDONLY);
+    if (fd == -1) {
+        logEvent(LOG_ERROR, OP_FILE_OPEN_ERROR, fileName);
+        return ERROR_UNKNOWN;
+    }
+    
+    // İzleme ilk okumadan önce kurulur; arada eklenenler kaçırılmaz. Silinme
+    // bağlantı sayısının değişmesiyle (IN_ATTRIB) fark edilir, çünkü açık
+    // tanımlayıcı varken IN_DELETE_SELF gelmez.
+    watchFd = inotify_init1(IN_CLOEXEC);
+    if (watchFd == -1 || inotify_add_watch(watchFd, fileName, IN_MODIFY | IN_ATTRIB | IN_DELETE_SELF) == -1 ||
+        fstat(fd, &st) == -1) {
+        if (watchFd != -1) {
+            close(watchFd);
+        }
+        close(fd);
+        logEvent(LOG_ERROR, OP_FILE_READ_ERROR, fileName);
+        return ERROR_UNKNOWN;
+    }
+    
+    if (tailLines >= 0 && st.st_size > 0) {
+        offset = findTailOffset(fd, st.st_size, tailLines);
+        if (offset < 0) {
+            close(watchFd);
+            close(fd);
+            logEvent(LOG_ERROR, OP_FILE_READ_ERROR, fileName);
+            return ERROR_UNKNOWN;
+        }
+    }
+    
+    string_format(logMsg, sizeof(logMsg), "%s (takip)", fileName);
+    logEvent(LOG_INFO, OP_FILE_READ, logMsg);
+    
+    const char* header = "\n--- Dosya İçeriği ---\n";
+    write(getOutputFd(), header, strlen(header));
+    
+    // Olaylar tek tek işlenmez; her uyanışta dosyanın son durumuna bakılır
+    result = writeFollowedRange(fd, fileName, &offset, &deleted);
+    while (result == SUCCESS && !deleted) {
+        ssize_t bytesRead = read(watchFd, events, sizeof(events));
+        if (bytesRead < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result = ERROR_UNKNOWN;
+            break;
+        }
+        result = writeFollowedRange(fd, fileName, &offset, &deleted);
+    }
+    
+    const char* footer = "\n--------------------\n";
+    write(getOutputFd(), footer, strlen(footer));
+    
+    close(watchFd);
+    close(fd);
+    
+    if (result != SUCCESS) {
+        if (result == ERROR_LOCK_TIMEOUT) {
+            logLockFailure(fileName, result);
+        } else {
+            logEvent(LOG_ERROR, OP_FILE_READ_ERROR, fileName);
+        }
+    }
+    return result;
+}
+
+/**
+ * Dosya içeriğini okur
+ */
+ErrorCode readFile(const char* fileName) {
+    return readFileRange(fileName, 0, -1);
+}
+
+/**
+ * Dosyaya içerik ekleme
+ */
+ErrorCode appendToFile(const char* fileName, const char* content) {
+    int fd;
+    ErrorCode result;
+    
+    // Dosyanın mevcut olup olmadığını kontrol et
+    if (!fileExists(fileName)) {
+        logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, fileName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Dosyayı aç
+    fd = open(fileName, O_WRONLY | O_APPEND);
+    if (fd == -1) {
+        logEvent(LOG_ERROR, OP_FILE_OPEN_ERROR, fileName);
+        return ERROR_UNKNOWN;
+    }
+    
+    // Dosyayı kilitle
+    result = lockFileForAppend(fd);
+    if (result != SUCCESS) {
+        close(fd);
+        logLockFailure(fileName, result);
+        return result;
+    }
+    
+    // İçerik ve yeni satır tek çağrıyla yazılır
+    struct iovec iov[2] = {
+        { (void*)content, strlen(content) },
+        { "\n", 1 }
+    };
+    if (writevAll(fd, iov, 2, -1) == -1) {
+        unlockFile(fd);
+        close(fd);
+        logEvent(LOG_ERROR, OP_FILE_WRITE_ERROR, fileName);
+        return ERROR_UNKNOWN;
+    }
+    
+    // Kilidi kaldır ve dosyayı kapat
+    unlockFile(fd);
+    close(fd);
+    
+    // Log mesajı oluştur
+    logWithLockWait(OP_FILE_APPENDED, fileName);
+    
+    return SUCCESS;
+}
+
+/**
+ * Kaynağın kalanını hedefin verilen konumundan itibaren yazar
+ * 
+ * @param position Yazma konumu; yazılan kadar ilerletilir
+ * @param ensureNewline Buffer ile kopyalamada içerik yeni satırla bitmiyorsa ekle
+ * @param lastByte Yazılan son bayt (buffer ile kopyalamada; bilinmiyorsa -1)
+ * @return Başarı durumu
+ */
+static ErrorCode copyStreamAt(int sourceFd, int fd, off_t* position, int ensureNewline, int* lastByte) {
+    struct stat st;
+    off_t limit = -1;   // Normal dosyada kopyalanacak kalan bayt (-1: dosya sonuna kadar)
+    
+    *lastByte = -1;
+    if (fstat(sourceFd, &st) == -1) {
+        return ERROR_UNKNOWN;
+    }
+    
+    // 1) copy_file_range: normal dosyadan, kaynak konumundan dosya sonuna kadar
+    //    (kaynak hedefin kendisi olsa da başlangıçtaki boyutta durur)
+    if (S_ISREG(st.st_mode)) {
+        off_t sourceOffset = lseek(sourceFd, 0, SEEK_CUR);
+        off_t remaining = (sourceOffset >= 0 && st.st_size > sourceOffset) ? st.st_size - sourceOffset : 0;
+        
+        while (remaining > 0) {
+            size_t chunk = (remaining > STREAM_CHUNK_SIZE) ? STREAM_CHUNK_SIZE : (size_t)remaining;
+            ssize_t copied = copy_file_range(sourceFd, NULL, fd, position, chunk, 0);
+            if (copied > 0) {
+                remaining -= copied;
+                continue;
+            }
+            if (copied == 0) {
+                return SUCCESS;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EXDEV || errno == EINVAL || errno == ENOSYS || errno == EOPNOTSUPP || errno == EBADF) {
+                break;  // Bu dosya sistemleri arasında desteklenmiyor
+            }
+            return ERROR_UNKNOWN;
+        }
+        if (remaining == 0) {
+            return SUCCESS;
+        }
+        
+        // Buffer ile kopyalama da başlangıçtaki boyutta durur; kaynak hedefin
+        // kendisiyse büyüyen dosya sonuna hiç ulaşılmaz
+        limit = remaining;
+    }
+    
+    // 2) splice: kaynak bir pipe ise veri kullanıcı alanına kopyalanmaz
+    if (S_ISFIFO(st.st_mode)) {
+        for (;;) {
+            ssize_t moved = splice(sourceFd, NULL, fd, position, STREAM_CHUNK_SIZE, SPLICE_F_MOVE | SPLICE_F_MORE);
+            if (moved > 0) {
+                continue;
+            }
+            if (moved == 0) {
+                return SUCCESS;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EINVAL || errno == ENOSYS) {
+                break;
+            }
+            return ERROR_UNKNOWN;
+        }
+    }
+    
+    // 3) Büyük buffer: dolana kadar okunur, son parça yeni satırla birlikte yazılabilsin diye saklanır
+    void* buffer;
+    if (posix_memalign(&buffer, STREAM_BUFFER_ALIGNMENT, STREAM_BUFFER_SIZE) != 0) {
+        return ERROR_UNKNOWN;
+    }
+    
+    ErrorCode result = SUCCESS;
+    int eof = 0;
+    while (!eof) {
+        size_t filled = 0;
+        while (filled < STREAM_BUFFER_SIZE) {
+            size_t want = STREAM_BUFFER_SIZE - filled;
+            if (limit >= 0 && (off_t)want > limit) {
+                want = (size_t)limit;
+            }
+            if (want == 0) {
+                eof = 1;
+                break;
+            }
+            ssize_t bytesRead = read(sourceFd, (char*)buffer + filled, want);
+            if (bytesRead < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                result = ERROR_UNKNOWN;
+                break;
+            }
+            if (bytesRead == 0) {
+                eof = 1;
+                break;
+            }
+            filled += (size_t)bytesRead;
+            if (limit >= 0) {
+                limit -= bytesRead;
+            }
+        }
+        if (result != SUCCESS) {
+            break;
+        }
+        
+        if (filled > 0) {
+            *lastByte = ((unsigned char*)buffer)[filled - 1];
+        }
+        
+        // Son parça ve gerekiyorsa yeni satır tek çağrıyla yazılır
+        int addNewline = ensureNewline && eof && *lastByte != '\n';
+        struct iovec iov[2] = {
+            { buffer, filled },
+            { "\n", 1 }
+        };
+        if (writevAll(fd, iov, addNewline ? 2 : 1, *position) == -1) {
+            result = ERROR_UNKNOWN;
+            break;
+        }
+        *position += (off_t)filled + addNewline;
+        if (addNewline) {
+            *lastByte = '\n';
+        }
+    }
+    
+    free(buffer);
+    return result;
+}
+
+/**
+ * Açık bir kaynaktaki içeriğin tamamını dosyaya ekler
+ */
+ErrorCode appendStreamToFile(const char* fileName, int sourceFd) {
+    char logMsg[MAX_PATH_LENGTH + 100];
+    struct stat st;
+    int lastByte;
+    int fd;
+    
+    // Dosyanın mevcut olup olmadığını kontrol et
+    if (!fileExists(fileName)) {
+        logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, fileName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // copy_file_range ve splice O_APPEND ile açılmış hedefe yazamaz; konum
+    // kilit altında dosya sonundan alınır. Son baytı okuyabilmek için O_RDWR.
+    fd = open(fileName, O_RDWR);
+    if (fd == -1) {
+        logEvent(LOG_ERROR, OP_FILE_OPEN_ERROR, fileName);
+        return ERROR_UNKNOWN;
+    }
+    
+    // Dosya (paylaşımlı modda dosya sonu) tüm ekleme boyunca kilitli kalır
+    ErrorCode result = lockFileForAppend(fd);
+    if (result != SUCCESS) {
+        close(fd);
+        logLockFailure(fileName, result);
+        return result;
+    }
+    
+    if (fstat(fd, &st) == -1) {
+        unlockFile(fd);
+        close(fd);
+        logEvent(LOG_ERROR, OP_FILE_WRITE_ERROR, fileName);
+        return ERROR_UNKNOWN;
+    }
+    off_t start = st.st_size;
+    off_t position = start;
+    
+    result = copyStreamAt(sourceFd, fd, &position, 1, &lastByte);
+    
+    // Çekirdek içinde kopyalanan içeriğin son baytına bakılır
+    if (result == SUCCESS && lastByte == -1 && position > start) {
+        unsigned char last;
+        lastByte = (pread(fd, &last, 1, position - 1) == 1) ? last : -1;
+    }
+    if (result == SUCCESS && lastByte != '\n') {
+        struct iovec iov = { "\n", 1 };
+        if (writevAll(fd, &iov, 1, position) == -1) {
+            result = ERROR_UNKNOWN;
+        } else {
+            position++;
+        }
+    }
+    
+    // Yarım kalan ekleme geri alınır
+    if (result != SUCCESS) {
+        ftruncate(fd, start);
+    }
+    
+    unlockFile(fd);
+    close(fd);
+    
+    if (result != SUCCESS) {
+        logEvent(LOG_ERROR, OP_FILE_WRITE_ERROR, fileName);
+        return result;
+    }
+    
+    string_format(logMsg, sizeof(logMsg), "%s (%lld bayt)", fileName, (long long)(position - start));
+    logWithLockWait(OP_FILE_APPENDED, logMsg);
+    return SUCCESS;
+}
+
+/**
+ * Kaynak dosyanın içeriğini dosyaya ekler
+ */
+ErrorCode appendFileContents(const char* fileName, const char* sourceName) {
+    int sourceFd = open(sourceName, O_RDONLY | O_CLOEXEC);
+    if (sourceFd == -1) {
+        logEvent(LOG_ERROR, (errno == ENOENT) ? OP_FILE_NOT_FOUND : OP_FILE_OPEN_ERROR, sourceName);
+        return (errno == ENOENT) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+    }
+    
+    ErrorCode result = appendStreamToFile(fileName, sourceFd);
+    close(sourceFd);
+    return result;
+}
+
+/**
+ * Açık kaynak dosyayı yeni bir hedef dosyaya kopyalar; kaynak kapatılmaz
+ * 
+ * @param forMove Taşıma için: izinler (umask'tan bağımsız) ve erişim/değişiklik
+ *                zamanları korunur, hedef kapatılmadan önce diske yazılır (fsync)
+ * @param method Kullanılan yöntem ("reflink" veya "kopya")
+ * @return Başarı durumu (hata durumunda hedef silinir)
+ */
+static ErrorCode copyOpenFile(int sourceFd, const char* destination, int forMove, const char** method) {
+    struct stat st;
+    int lastByte;
+    off_t position = 0;
+    ErrorCode result;
+    
+    if (fstat(sourceFd, &st) == -1 || !S_ISREG(st.st_mode)) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    int fd = open(destination, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, st.st_mode & 0777);
+    if (fd == -1) {
+        return (errno == EEXIST) ? ERROR_FILE_EXISTS : ERROR_UNKNOWN;
+    }
+    
+    // Hedef, içerik tamamlanana kadar kilitli kalır
+    result = lockFile(fd);
+    if (result == SUCCESS) {
+        // 1) Reflink: aynı dosya sisteminde bloklar paylaşılır, veri kopyalanmaz
+        if (ioctl(fd, FICLONE, sourceFd) == 0) {
+            *method = "reflink";
+        } else {
+            // 2) copy_file_range, 3) büyük buffer
+            *method = "kopya";
+            result = copyStreamAt(sourceFd, fd, &position, 0, &lastByte);
+        }
+        if (result == SUCCESS && forMove) {
+            struct timespec times[2] = { st.st_atim, st.st_mtim };
+            if (fchmod(fd, st.st_mode & 07777) == -1 || futimens(fd, times) == -1 || fsync(fd) == -1) {
+                result = ERROR_UNKNOWN;
+            }
+        }
+        unlockFile(fd);
+    }
+    
+    if (close(fd) == -1 && result == SUCCESS) {
+        result = ERROR_UNKNOWN;
+    }
+    
+    if (result != SUCCESS) {
+        unlink(destination);
+    }
+    return result;
+}
+
+/**
+ * Kaynak dosyayı yeni bir hedef dosyaya kopyalar; log kaydı tutmaz
+ * 
+ * @param lockSource Kaynak okunurken paylaşımlı kilitlensin mi
+ * @param method Kullanılan yöntem ("reflink" veya "kopya")
+ * @return Başarı durumu (hata durumunda hedef silinir)
+ */
+static ErrorCode copyFileData(const char* source, const char* destination, int lockSource, const char** method) {
+    ErrorCode result = SUCCESS;
+    
+    int sourceFd = open(source, O_RDONLY | O_CLOEXEC);
+    if (sourceFd == -1) {
+        return (errno == ENOENT) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+    }
+    
+    if (lockSource) {
+        result = lockFileRange(sourceFd, F_RDLCK, 0, 0);
+    }
+    if (result == SUCCESS) {
+        result = copyOpenFile(sourceFd, destination, 0, method);
+    }
+    
+    close(sourceFd);
+    return result;
+}
+
+/**
+ * Dosyayı kopyalar
+ */
+ErrorCode copyFile(const char* source, const char* destination) {
+    char logMsg[MAX_PATH_LENGTH * 2 + 100];
+    const char* method = "";
+    
+    // Kaynağın mevcut olup olmadığını kontrol et
+    if (!fileExists(source)) {
+        logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, source);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Hedefin zaten var olup olmadığını kontrol et
+    if (fileExists(destination)) {
+        logEvent(LOG_ERROR, OP_FILE_EXISTS, destination);
+        return ERROR_FILE_EXISTS;
+    }
+    
+    // Paylaşımlı modda kaynak, okuyanlar gibi paylaşımlı kilitlenir
+    ErrorCode result = copyFileData(source, destination, lockMode == LOCK_MODE_SHARED, &method);
+    
+    string_format(logMsg, sizeof(logMsg), "%s -> %s", source, destination);
+    if (result == ERROR_LOCK_TIMEOUT) {
+        logLockFailure(logMsg, result);
+    } else if (result != SUCCESS) {
+        logEvent(LOG_ERROR, OP_FILE_COPY_ERROR, logMsg);
+    } else {
+        string_format(logMsg, sizeof(logMsg), "%s -> %s (%s)", source, destination, method);
+        logWithLockWait(OP_FILE_COPIED, logMsg);
+    }
+    
+    return result;
+}
+
+/**
+ * Dosyayı taşır
+ */
+ErrorCode moveFile(const char* source, const char* destination) {
+    char logMsg[MAX_PATH_LENGTH * 2 + 100];
+    const char* method = "yeniden adlandırma";
+    ErrorCode result = SUCCESS;
+    int copied = 0;
+    
+    // Kaynağın mevcut olup olmadığını kontrol et
+    if (!fileExists(source)) {
+        logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, source);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Hedefin üzerine yazılmaz; renameat2 desteklenmiyorsa varlık önceden kontrol edilir
+    int rc = renameat2(AT_FDCWD, source, AT_FDCWD, destination, RENAME_NOREPLACE);
+    if (rc == -1 && (errno == EINVAL || errno == ENOSYS)) {
+        if (fileExists(destination)) {
+            errno = EEXIST;
+        } else {
+            rc = rename(source, destination);
+        }
+    }
+    
+    if (rc == -1 && errno == EEXIST) {
+        result = ERROR_FILE_EXISTS;
+    } else if (rc == -1 && errno == EXDEV) {
+        // Farklı dosya sistemi: kaynak kopya, fsync ve silme boyunca okuma
+        // kilidiyle tutulur; salt okunur kaynaklar da taşınabilir. Kilidi
+        // bekleyen ekleyiciler kilidi aldıklarında dosyanın silindiğini görüp
+        // hata döndürür. Kilit almadan yazan programların bu arada yaptığı
+        // değişiklikler kopyaya yansımayabilir.
+        int sourceFd = open(source, O_RDONLY | O_CLOEXEC);
+        result = (sourceFd == -1) ? ((errno == EACCES) ? ERROR_PERMISSION_DENIED : ERROR_UNKNOWN)
+                                  : lockFileRange(sourceFd, F_RDLCK, 0, 0);
+        if (result == SUCCESS) {
+            copied = 1;
+            result = copyOpenFile(sourceFd, destination, 1, &method);
+            if (result == SUCCESS && unlink(source) == -1) {
+                unlink(destination);
+                result = ERROR_UNKNOWN;
+            }
+            unlockFile(sourceFd);
+        }
+        if (sourceFd != -1) {
+            close(sourceFd);
+        }
+    } else if (rc == -1) {
+        result = (errno == EACCES || errno == EPERM) ? ERROR_PERMISSION_DENIED : ERROR_UNKNOWN;
+    }
+    
+    string_format(logMsg, sizeof(logMsg), "%s -> %s", source, destination);
+    if (result == ERROR_FILE_EXISTS) {
+        logEvent(LOG_ERROR, OP_FILE_EXISTS, destination);
+    } else if (result == ERROR_LOCK_TIMEOUT) {
+        logLockFailure(logMsg, result);
+    } else if (result != SUCCESS) {
+        logEvent(LOG_ERROR, OP_FILE_MOVE_ERROR, logMsg);
+    } else {
+        string_format(logMsg, sizeof(logMsg), "%s -> %s (%s)", source, destination, method);
+        if (copied) {
+            logWithLockWait(OP_FILE_MOVED, logMsg);
+        } else {
+            logEvent(LOG_INFO, OP_FILE_MOVED, logMsg);
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * Kayıt sıralarını dosya adına, aynı dosyada verilme sırasına göre sıralar
+ */
+static int compareAppendRecords(const void* a, const void* b, void* context) {
+    const AppendRecord* records = context;
+    size_t x = *(const size_t*)a;
+    size_t y = *(const size_t*)b;
+    
+    int cmp = strcmp(records[x].fileName, records[y].fileName);
+    if (cmp != 0) {
+        return cmp;
+    }
+    return (x > y) - (x < y);
+}
+
+/**
+ * Aynı dosyaya ait kayıtları tek kilit altında ekler
+ * 
+ * @param order Grubun kayıt sıraları
+ * @return Başarı durumu (grubun tüm kayıtları için)
+ */
+static ErrorCode appendRecordGroup(const AppendRecord* records, const size_t* order, size_t count,
+                                   struct iovec* iov, size_t iovCapacity) {
+    const char* fileName = records[order[0]].fileName;
+    char logMsg[MAX_PATH_LENGTH + 100];
+    struct stat st;
+    
+    int fd = open(fileName, O_WRONLY | O_APPEND | O_CLOEXEC);
+    if (fd == -1) {
+        if (errno == ENOENT) {
+            logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, fileName);
+            return ERROR_FILE_NOT_FOUND;
+        }
+        logEvent(LOG_ERROR, OP_FILE_OPEN_ERROR, fileName);
+        return (errno == EACCES) ? ERROR_PERMISSION_DENIED : ERROR_UNKNOWN;
+    }
+    
+    ErrorCode result = lockFileForAppend(fd);
+    if (result != SUCCESS) {
+        close(fd);
+        logLockFailure(fileName, result);
+        return result;
+    }
+    
+    // Başlangıç boyutu yarım kalan yazmayı geri almak için
+    off_t start = (fstat(fd, &st) == 0) ? st.st_size : -1;
+    
+    // Her kayıt içerik + yeni satır olarak iki parça; writev sınırına göre bölünür
+    size_t next = 0;
+    while (next < count && result == SUCCESS) {
+        size_t used = 0;
+        while (next < count && used + 2 <= iovCapacity) {
+            const AppendRecord* record = &records[order[next++]];
+            iov[used].iov_base = (void*)record->content;
+            iov[used].iov_len = record->length;
+            iov[used + 1].iov_base = "\n";
+            iov[used + 1].iov_len = 1;
+            used += 2;
+        }
+        if (writevAll(fd, iov, (int)used, -1) == -1) {
+            result = ERROR_UNKNOWN;
+        }
+    }
+    
+    if (result != SUCCESS && start >= 0) {
+        ftruncate(fd, start);
+    }
+    
+    unlockFile(fd);
+    close(fd);
+    
+    if (result != SUCCESS) {
+        logEvent(LOG_ERROR, OP_FILE_WRITE_ERROR, fileName);
+        return result;
+    }
+    
+    // Dosya başına tek log kaydı
+    string_format(logMsg, sizeof(logMsg), "%s (%lu kayıt)", fileName, (unsigned long)count);
+    logWithLockWait(OP_FILE_APPENDED, logMsg);
+    return SUCCESS;
+}
+
+/**
+ * Kayıtları dosyalarına göre gruplayarak ekler
+ */
+ErrorCode appendRecords(const AppendRecord* records, size_t count, ErrorCode* results) {
+    ErrorCode firstError = SUCCESS;
+    
+    if (records == NULL && count > 0) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    if (count == 0) {
+        return SUCCESS;
+    }
+    
+    long iovMax = sysconf(_SC_IOV_MAX);
+    size_t iovCapacity = (iovMax > 0) ? (size_t)iovMax : 1024;
+    size_t* order = malloc(sizeof(size_t) * count);
+    struct iovec* iov = malloc(sizeof(struct iovec) * iovCapacity);
+    if (order == NULL || iov == NULL) {
+        free(order);
+        free(iov);
+        return ERROR_UNKNOWN;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    qsort_r(order, count, sizeof(size_t), compareAppendRecords, (void*)records);
+    
+    size_t groupStart = 0;
+    while (groupStart < count) {
+        size_t groupEnd = groupStart + 1;
+        while (groupEnd < count &&
+               strcmp(records[order[groupEnd]].fileName, records[order[groupStart]].fileName) == 0) {
+            groupEnd++;
+        }
+        
+        ErrorCode result = appendRecordGroup(records, order + groupStart, groupEnd - groupStart, iov, iovCapacity);
+        if (result != SUCCESS && firstError == SUCCESS) {
+            firstError = result;
+        }
+        if (results != NULL) {
+            for (size_t i = groupStart; i < groupEnd; i++) {
+                results[order[i]] = result;
+            }
+        }
+        groupStart = groupEnd;
+    }
+    
+    free(order);
+    free(iov);
+    return firstError;
+}
+
+/**
+ * deleteFile görevi: dosyayı siler
+ */
+static int deleteFileTask(void* arg) {
+    return (unlink((const char*)arg) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * Dosya silme
+ */
+ErrorCode deleteFile(const char* fileName) {
+    int status;
+    
+    // Dosyanın mevcut olup olmadığını kontrol et
+    if (!fileExists(fileName)) {
+        logEvent(LOG_ERROR, OP_FILE_NOT_FOUND, fileName);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Silme işlemini çalıştır (yalıtım modunda ayrı işlemde)
+    status = runTask(deleteFileTask, (void*)fileName);
+    
+    if (status == -1) {
+        logEvent(LOG_ERROR, OP_FORK_ERROR, fileName);
+        return ERROR_UNKNOWN;
+    } else if (status == EXIT_SUCCESS) {
+        // Log mesajı oluştur
+        logEvent(LOG_INFO, OP_FILE_DELETED, fileName);
+        return SUCCESS;
+    } else {
+        logEvent(LOG_ERROR, OP_FILE_DELETE_ERROR, fileName);
+        return ERROR_UNKNOWN;
     }
-} 
\ No newline at end of file
+}
\ No newline at end of file
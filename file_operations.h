@@ -8,6 +8,28 @@
 
 #include "file_system.h"
 
+#define LOCK_BACKOFF_MIN_US 50             // Zaman aşımlı kilitte ilk bekleme
+#define LOCK_BACKOFF_MAX_US 5000           // Zaman aşımlı kilitte en uzun bekleme
+#define LOCK_WAIT_LOG_THRESHOLD_NS 1000000LL    // Bundan uzun kilit beklemeleri işlemin log kaydına yazılır
+
+/**
+ * Kilit bekleme istatistikleri (işlem başından beri)
+ */
+typedef struct {
+    unsigned long acquisitions;         // Alınan kilit sayısı
+    unsigned long timeouts;             // Zaman aşımına uğrayan deneme sayısı
+    unsigned long long totalWaitNs;     // Toplam bekleme süresi
+    unsigned long long maxWaitNs;       // En uzun tek bekleme
+} LockStats;
+
+/**
+ * Dosya kilitleme modu (--lock-mode)
+ */
+typedef enum {
+    LOCK_MODE_EXCLUSIVE = 0,    // Yazanlar tüm dosyayı özel kilitler, okuyanlar kilit almaz
+    LOCK_MODE_SHARED            // Okuyanlar okudukları aralığı paylaşımlı, ekleyenler yalnızca dosya sonunu kilitler
+} LockMode;
+
 /**
  * Verilen isimde yeni bir dosya oluşturur
  * 
@@ -16,6 +38,16 @@
  */
 ErrorCode createFile(const char* fileName);
 
+/**
+ * O_EXCL ile yeni oluşturulmuş dosyayı kilitler, oluşturulma zamanını yazar
+ * ve dosyayı kapatır (createFile'ın açmadan sonraki adımları)
+ * 
+ * @param fd Dosya tanımlayıcısı; her durumda kapatılır
+ * @param fileName Log kayıtları için dosya adı
+ * @return Başarı durumu
+ */
+ErrorCode stampCreatedFile(int fd, const char* fileName);
+
 /**
  * Dosya içeriğini okur
  * 
@@ -24,6 +56,83 @@ ErrorCode createFile(const char* fileName);
  */
 ErrorCode readFile(const char* fileName);
 
+/**
+ * Dosyanın bir aralığını okur; veri mümkünse sendfile/splice ile çekirdek
+ * içinde doğrudan çıktıya aktarılır
+ * 
+ * @param fileName Okunacak dosyanın adı
+ * @param offset Başlangıç konumu
+ * @param length Okunacak bayt sayısı (-1: dosya sonuna kadar)
+ * @return Başarı durumu
+ */
+ErrorCode readFileRange(const char* fileName, long long offset, long long length);
+
+/**
+ * Dosyanın ilk satırlarını okur. Dosya pencereler halinde eşlenir ve yalnızca
+ * istenen satır sonuna kadar taranır.
+ * 
+ * @param fileName Okunacak dosyanın adı
+ * @param lines Satır sayısı
+ * @return Başarı durumu
+ */
+ErrorCode readFileHead(const char* fileName, long long lines);
+
+/**
+ * Dosyanın son satırlarını okur. Satır başı dosyanın sonundan geriye doğru
+ * aranır; dosyanın geri kalanı okunmaz.
+ * 
+ * @param fileName Okunacak dosyanın adı
+ * @param lines Satır sayısı
+ * @return Başarı durumu
+ */
+ErrorCode readFileTail(const char* fileName, long long lines);
+
+/**
+ * Dosyanın içeriğini (veya son satırlarını) yazar, ardından inotify ile
+ * dosyayı izleyerek yalnızca yeni eklenen baytları yazar. Dosya kısaltılırsa
+ * baştan okumaya devam eder; dosya silinince kalan baytları yazıp döner.
+ * 
+ * @param fileName Okunacak dosyanın adı
+ * @param tailLines Başlangıçta yazılacak son satır sayısı (-1: tüm içerik)
+ * @return Başarı durumu
+ */
+ErrorCode followFile(const char* fileName, long long tailLines);
+
+/**
+ * Açık bir dosyanın aralığını verilen tanımlayıcıya kopyalar
+ * (sendfile, ardından splice, son çare olarak büyük hizalı buffer)
+ * 
+ * @param inFd Kaynak dosya tanımlayıcısı
+ * @param outFd Hedef tanımlayıcı (dosya, pipe veya soket)
+ * @param offset Başlangıç konumu
+ * @param length Kopyalanacak bayt sayısı
+ * @return Başarı durumu
+ */
+ErrorCode streamFileRange(int inFd, int outFd, off_t offset, off_t length);
+
+/**
+ * Dosya içeriğini parça parça geri çağırma fonksiyonuna iletir.
+ * Fork yapmaz ve log kaydı tutmaz.
+ * 
+ * @param fileName Okunacak dosyanın adı
+ * @param callback Her parça için çağrılacak fonksiyon
+ * @param userData Geri çağırma fonksiyonuna iletilecek veri
+ * @return Başarı durumu
+ */
+ErrorCode readFileChunks(const char* fileName, DataChunkCallback callback, void* userData);
+
+/**
+ * Dosya içeriğini çağıranın verdiği buffer'a okur (sığan kadarı).
+ * Fork yapmaz ve log kaydı tutmaz.
+ * 
+ * @param fileName Okunacak dosyanın adı
+ * @param buffer Hedef buffer
+ * @param size Buffer boyutu
+ * @param bytesRead Okunan bayt sayısı
+ * @return Başarı durumu
+ */
+ErrorCode readFileToBuffer(const char* fileName, char* buffer, size_t size, size_t* bytesRead);
+
 /**
  * Dosyaya yeni içerik ekler
  * 
@@ -33,6 +142,73 @@ ErrorCode readFile(const char* fileName);
  */
 ErrorCode appendToFile(const char* fileName, const char* content);
 
+/**
+ * Açık bir kaynaktaki içeriğin tamamını dosyaya ekler. Kaynak normal bir
+ * dosyaysa copy_file_range, pipe ise splice kullanılır, diğer durumlarda büyük
+ * bir buffer ile okunur. Dosya işlem boyunca kilitli kalır; yazma yarıda
+ * kalırsa eklenen kısım geri alınır. İçerik yeni satırla bitmiyorsa sonuna
+ * yeni satır eklenir.
+ * 
+ * @param fileName İçerik eklenecek dosyanın adı
+ * @param sourceFd Kaynak tanımlayıcı (örn: STDIN_FILENO); mevcut konumundan okunur
+ * @return Başarı durumu
+ */
+ErrorCode appendStreamToFile(const char* fileName, int sourceFd);
+
+/**
+ * Toplu eklemede tek kayıt
+ */
+typedef struct {
+    const char* fileName;
+    const char* content;
+    size_t length;              // İçerik uzunluğu (yeni satır hariç)
+} AppendRecord;
+
+/**
+ * Kayıtları dosyalarına göre gruplar ve her dosyaya tek kilit/writev/kilit
+ * açma döngüsüyle ekler. Aynı dosyanın kayıtları verildikleri sırayla, her
+ * biri yeni satırla yazılır. Bir grubun yazması yarıda kalırsa o grup geri
+ * alınır ve tüm kayıtları hatalı sayılır.
+ * 
+ * @param records Kayıtlar
+ * @param count Kayıt sayısı
+ * @param results Her kaydın sonucu (count elemanlı, NULL olabilir)
+ * @return Tüm kayıtlar eklendiyse SUCCESS, aksi halde ilk hatanın kodu
+ */
+ErrorCode appendRecords(const AppendRecord* records, size_t count, ErrorCode* results);
+
+/**
+ * Kaynak dosyanın içeriğini dosyaya ekler (appendStreamToFile ile)
+ * 
+ * @param fileName İçerik eklenecek dosyanın adı
+ * @param sourceName İçeriği eklenecek kaynak dosya
+ * @return Başarı durumu
+ */
+ErrorCode appendFileContents(const char* fileName, const char* sourceName);
+
+/**
+ * Dosyayı yeni bir dosyaya kopyalar. Önce reflink (FICLONE) denenir, olmazsa
+ * copy_file_range, o da olmazsa büyük buffer ile kopyalanır. Hedef içerik
+ * tamamlanana kadar kilitli kalır; kopyalama yarıda kalırsa hedef silinir.
+ * 
+ * @param source Kaynak dosya
+ * @param destination Hedef dosya (mevcut olmamalı)
+ * @return Başarı durumu
+ */
+ErrorCode copyFile(const char* source, const char* destination);
+
+/**
+ * Dosyayı taşır. Aynı dosya sisteminde renameat2(RENAME_NOREPLACE) ile
+ * yeniden adlandırılır; farklı dosya sistemlerinde kaynak okuma kilidiyle
+ * kilitlenip izin ve zamanlarıyla kopyalanır, kopya fsync ile diske yazılır
+ * ve kaynak silinir.
+ * 
+ * @param source Kaynak dosya
+ * @param destination Hedef dosya (mevcut olmamalı)
+ * @return Başarı durumu
+ */
+ErrorCode moveFile(const char* source, const char* destination);
+
 /**
  * Dosyayı siler
  * 
@@ -41,6 +217,84 @@ ErrorCode appendToFile(const char* fileName, const char* content);
  */
 ErrorCode deleteFile(const char* fileName);
 
+/**
+ * Kilitleme modunu ayarlar
+ * 
+ * @param mode LOCK_MODE_EXCLUSIVE (varsayılan) veya LOCK_MODE_SHARED
+ */
+void setLockMode(LockMode mode);
+
+/**
+ * Kilitleme modunu döndürür
+ * 
+ * @return Geçerli kilitleme modu
+ */
+LockMode getLockMode();
+
+/**
+ * Kilit alma süresini sınırlar (--lock-timeout)
+ * 
+ * @param timeoutMs -1: Süresiz bekle (varsayılan), 0: Tek deneme, >0: En fazla bu kadar ms dene
+ */
+void setLockTimeout(int timeoutMs);
+
+/**
+ * Kilit alma süre sınırını döndürür
+ * 
+ * @return Süre sınırı (ms, -1: sınırsız)
+ */
+int getLockTimeout();
+
+/**
+ * Çağıran iş parçacığının son kilit denemesinde beklediği süreyi döndürür
+ * 
+ * @return Bekleme süresi (ns)
+ */
+unsigned long long getLastLockWait();
+
+/**
+ * Kilit bekleme istatistiklerini döndürür
+ * 
+ * @param stats Doldurulacak istatistikler
+ */
+void getLockStats(LockStats* stats);
+
+/**
+ * Dosyanın bir aralığını kilitler. Süre sınırı yoksa kilit alınana kadar
+ * bekler; varsa kilidi artan aralıklarla (geri çekilerek) dener. Açık dosya
+ * tanımına bağlı (OFD) kilitler kullanılır; aynı işlemdeki iş parçacıkları
+ * farklı tanımlayıcılarla birbirini dışlar. Çekirdek desteklemiyorsa klasik
+ * kayıt kilitlerine dönülür.
+ * 
+ * @param fd Dosya tanımlayıcısı
+ * @param type F_RDLCK (paylaşımlı) veya F_WRLCK (özel)
+ * @param start Aralığın başı
+ * @param length Aralığın uzunluğu (0: dosya sonu ve ötesi)
+ * @return Başarı durumu (süre dolduysa ERROR_LOCK_TIMEOUT)
+ */
+ErrorCode lockFileRange(int fd, short type, off_t start, off_t length);
+
+/**
+ * Dosyaya ekleme için kilit alır. Paylaşımlı modda yalnızca dosyanın
+ * sonundan itibaren olan bölge kilitlenir; mevcut içeriği okuyanlar
+ * beklemez. Özel modda tüm dosya kilitlenir.
+ * 
+ * @param fd O_APPEND ile açılmış veya dosya sonuna yazacak tanımlayıcı
+ * @return Başarı durumu (kilit beklenirken dosya silindiyse ERROR_FILE_NOT_FOUND)
+ */
+ErrorCode lockFileForAppend(int fd);
+
+/**
+ * lockFileForAppend gibi kilitler ama kilit başkasındaysa beklemez. Başka
+ * kilitleri tutarken yeni kilit almak isteyenler (io_uring toplu arka ucu)
+ * birbirini sonsuza dek beklemesin diye kullanılır.
+ * 
+ * @param fd O_APPEND ile açılmış veya dosya sonuna yazacak tanımlayıcı
+ * @return Başarı durumu (kilit başkasındaysa ERROR_LOCK_TIMEOUT, dosya
+ *         silinmişse ERROR_FILE_NOT_FOUND)
+ */
+ErrorCode tryLockFileForAppend(int fd);
+
 /**
  * Dosyayı kilitleme işlemi
  * 
@@ -50,7 +304,7 @@ ErrorCode deleteFile(const char* fileName);
 ErrorCode lockFile(int fd);
 
 /**
- * Dosya kilidini açma işlemi
+ * Dosya kilidini açma işlemi (tanımlayıcının tuttuğu tüm aralıklar)
  * 
  * @param fd Dosya tanımlayıcısı
  * @return Başarı durumu
@@ -20,6 +20,7 @@
 #define MAX_PATH_LENGTH 256
 #define MAX_CONTENT_LENGTH 1024
 #define LOG_FILE "log.txt"
+#define DEFAULT_SOCKET_PATH "file_system.sock"
 
 /**
  * Hata kodları
@@ -31,6 +32,7 @@ typedef enum {
     ERROR_DIR_NOT_EMPTY = -3,
     ERROR_PERMISSION_DENIED = -4,
     ERROR_INVALID_ARGUMENT = -5,
+    ERROR_LOCK_TIMEOUT = -6,
     ERROR_UNKNOWN = -99
 } ErrorCode;
 
@@ -42,15 +44,38 @@ typedef enum {
     CMD_CREATE_FILE,
     CMD_LIST_DIR,
     CMD_LIST_FILES_BY_EXTENSION,
+    CMD_FILTER_FILES,
+    CMD_SEARCH_CONTENT,
     CMD_READ_FILE,
     CMD_APPEND_TO_FILE,
+    CMD_COPY_FILE,
+    CMD_MOVE_FILE,
+    CMD_COPY_DIR,
+    CMD_CHECKSUM,
     CMD_DELETE_FILE,
     CMD_DELETE_DIR,
     CMD_SHOW_LOGS,
+    CMD_BATCH,
+    CMD_APPEND_BATCH,
+    CMD_SERVE,
+    CMD_CLIENT,
+    CMD_LOGD,
     CMD_HELP,
     CMD_UNKNOWN
 } CommandType;
 
+/**
+ * Komut seçenek bayrakları
+ */
+#define CMD_FLAG_RECURSIVE 0x01     // -r: Alt dizinlerle birlikte
+#define CMD_FLAG_UNORDERED 0x02     // --unordered: Sonuçları bulunduğu sırayla yaz
+#define CMD_FLAG_STDIN 0x04         // --stdin: İçerik standart girdiden
+#define CMD_FLAG_FROM_FILE 0x08     // --from: İçerik arg2'deki dosyadan
+#define CMD_FLAG_HEAD 0x10          // --head N: İlk N satır
+#define CMD_FLAG_TAIL 0x20          // --tail N: Son N satır
+#define CMD_FLAG_FOLLOW 0x40        // --follow: Dosyaya eklenenleri izlemeye devam et
+#define CMD_FLAG_NO_CACHE 0x80      // --no-cache: Önbelleğe alınmış sağlama toplamını kullanma
+
 /**
  * Komut yapısı
  */
@@ -58,8 +83,36 @@ typedef struct {
     CommandType type;
     char arg1[MAX_PATH_LENGTH];
     char arg2[MAX_PATH_LENGTH];
+    const char* content;    // appendToFile içeriği (argv'yi gösterir, uzunluk sınırı yok)
+    long long offset;   // readFile --range başlangıcı
+    long long length;   // readFile --range uzunluğu (-1: dosya sonuna kadar)
+    long long sinceNs;  // showLogs --since (0: sınır yok)
+    long long untilNs;  // showLogs --until (0: sınır yok)
+    int logType;        // showLogs --type (-1: hepsi)
+    int limit;          // showLogs --limit (0: sınır yok), readFile --head/--tail satır sayısı, searchContent --max-kb, copyDir --max-inflight-mb
+    int flags;          // CMD_FLAG_* seçenekleri
 } Command;
 
+/**
+ * Dizin girdisi geri çağırma fonksiyonu
+ * 
+ * @param name Girdinin adı
+ * @param isDir 1: Dizin, 0: Dizin değil
+ * @param userData Çağıranın verdiği veri
+ * @return 0: Devam et, 0 dışı: Listelemeyi durdur
+ */
+typedef int (*DirEntryCallback)(const char* name, int isDir, void* userData);
+
+/**
+ * Veri parçası geri çağırma fonksiyonu
+ * 
+ * @param data Parça verisi
+ * @param length Parça uzunluğu
+ * @param userData Çağıranın verdiği veri
+ * @return 0: Devam et, 0 dışı: Okumayı durdur
+ */
+typedef int (*DataChunkCallback)(const char* data, size_t length, void* userData);
+
 // Standart dosya tanımlayıcıları
 #ifndef STDIN_FILENO
 #define STDIN_FILENO 0
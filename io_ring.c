@@ -0,0 +1,269 @@
+/**
+ * io_ring.c
+ * io_uring halkası sarmalayıcısının implementasyonları
+ */
+
+#include "io_ring.h"
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/**
+ * Halka durumu
+ */
+struct IoRing {
+    int fd;
+    
+    // Gönderim kuyruğu
+    void* sqMap;
+    size_t sqMapSize;
+    unsigned* sqHead;
+    unsigned* sqTail;
+    unsigned* sqMask;
+    unsigned* sqArray;
+    unsigned sqEntries;
+    unsigned sqLocalTail;       // Hazırlanmış ama yayınlanmamış girdiler dahil
+    struct io_uring_sqe* sqes;
+    size_t sqesSize;
+    
+    // Tamamlanma kuyruğu (tek mmap destekleniyorsa sqMap ile aynı bölge)
+    void* cqMap;
+    size_t cqMapSize;
+    unsigned* cqHead;
+    unsigned* cqTail;
+    unsigned* cqMask;
+    struct io_uring_cqe* cqes;
+};
+
+/**
+ * io_uring_enter sistem çağrısı
+ */
+static int ringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+    return (int)syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+/**
+ * Gereken işlemlerin çekirdek tarafından desteklenip desteklenmediğini sorar
+ */
+static int supportsOps(int fd, const unsigned char* ops, int opCount) {
+    size_t size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe* probe = calloc(1, size);
+    int supported = 1;
+    
+    if (probe == NULL) {
+        return 0;
+    }
+    
+    if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, 256) < 0) {
+        supported = 0;
+    }
+    for (int i = 0; supported && i < opCount; i++) {
+        if (ops[i] > probe->last_op || !(probe->ops[ops[i]].flags & IO_URING_OP_SUPPORTED)) {
+            supported = 0;
+        }
+    }
+    
+    free(probe);
+    return supported;
+}
+
+/**
+ * Seyrek (boş yuvalı) sabit dosya tablosu kaydeder
+ */
+static int registerSparseFiles(int fd, unsigned fileSlots) {
+    int* fds = malloc(sizeof(int) * fileSlots);
+    int rc;
+    
+    if (fds == NULL) {
+        return -1;
+    }
+    for (unsigned i = 0; i < fileSlots; i++) {
+        fds[i] = -1;
+    }
+    
+    rc = (int)syscall(__NR_io_uring_register, fd, IORING_REGISTER_FILES, fds, fileSlots);
+    free(fds);
+    return rc;
+}
+
+/**
+ * Halkayı oluşturur
+ */
+ErrorCode createIoRing(unsigned entries, unsigned fileSlots, const unsigned char* ops, int opCount, IoRing** ring) {
+    struct io_uring_params params;
+    IoRing* r;
+    
+    *ring = NULL;
+    
+    r = calloc(1, sizeof(IoRing));
+    if (r == NULL) {
+        return ERROR_UNKNOWN;
+    }
+    r->sqMap = MAP_FAILED;
+    r->cqMap = MAP_FAILED;
+    r->sqes = MAP_FAILED;
+    
+    memset(&params, 0, sizeof(params));
+    r->fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (r->fd < 0) {
+        free(r);
+        return ERROR_UNKNOWN;
+    }
+    
+    // Zincirdeki açma isteğinin doldurduğu yuvayı sonraki istekler kullanabilmeli
+    if (!supportsOps(r->fd, ops, opCount) ||
+        (fileSlots > 0 && (!(params.features & IORING_FEAT_LINKED_FILE) ||
+                           registerSparseFiles(r->fd, fileSlots) < 0))) {
+        destroyIoRing(r);
+        return ERROR_UNKNOWN;
+    }
+    
+    // Kuyrukları eşle
+    r->sqMapSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    r->cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (r->cqMapSize > r->sqMapSize) {
+            r->sqMapSize = r->cqMapSize;
+        }
+    }
+    
+    r->sqMap = mmap(NULL, r->sqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+    if (r->sqMap == MAP_FAILED) {
+        destroyIoRing(r);
+        return ERROR_UNKNOWN;
+    }
+    
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        r->cqMap = r->sqMap;
+    } else {
+        r->cqMap = mmap(NULL, r->cqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+        if (r->cqMap == MAP_FAILED) {
+            destroyIoRing(r);
+            return ERROR_UNKNOWN;
+        }
+    }
+    
+    r->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    r->sqes = mmap(NULL, r->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+    if (r->sqes == MAP_FAILED) {
+        destroyIoRing(r);
+        return ERROR_UNKNOWN;
+    }
+    
+    char* sq = r->sqMap;
+    r->sqHead = (unsigned*)(sq + params.sq_off.head);
+    r->sqTail = (unsigned*)(sq + params.sq_off.tail);
+    r->sqMask = (unsigned*)(sq + params.sq_off.ring_mask);
+    r->sqArray = (unsigned*)(sq + params.sq_off.array);
+    r->sqEntries = params.sq_entries;
+    r->sqLocalTail = *r->sqTail;
+    
+    char* cq = r->cqMap;
+    r->cqHead = (unsigned*)(cq + params.cq_off.head);
+    r->cqTail = (unsigned*)(cq + params.cq_off.tail);
+    r->cqMask = (unsigned*)(cq + params.cq_off.ring_mask);
+    r->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+    
+    *ring = r;
+    return SUCCESS;
+}
+
+/**
+ * Sabit dosya yuvalarını günceller
+ */
+ErrorCode updateIoRingFiles(IoRing* ring, unsigned offset, const int* fds, unsigned count) {
+    struct io_uring_files_update update;
+    int rc;
+    
+    memset(&update, 0, sizeof(update));
+    update.offset = offset;
+    update.fds = (unsigned long long)(uintptr_t)fds;
+    
+    do {
+        rc = (int)syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_FILES_UPDATE, &update, count);
+    } while (rc < 0 && errno == EINTR);
+    
+    return (rc == (int)count) ? SUCCESS : ERROR_UNKNOWN;
+}
+
+/**
+ * Boş bir gönderim girdisi döndürür
+ */
+struct io_uring_sqe* getIoRingSqe(IoRing* ring) {
+    unsigned head = __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    
+    if (ring->sqLocalTail - head >= ring->sqEntries) {
+        return NULL;
+    }
+    
+    unsigned index = ring->sqLocalTail & *ring->sqMask;
+    struct io_uring_sqe* sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    ring->sqArray[index] = index;
+    ring->sqLocalTail++;
+    return sqe;
+}
+
+/**
+ * Hazırlanan girdileri gönderir
+ */
+int submitIoRing(IoRing* ring) {
+    int rc;
+    
+    // Girdiler kuyruk sonu yayınlanmadan önce görünür olmalı
+    __atomic_store_n(ring->sqTail, ring->sqLocalTail, __ATOMIC_RELEASE);
+    
+    // Önceki çağrıda çekirdeğin almadığı girdiler de yeniden gönderilir
+    unsigned toSubmit = ring->sqLocalTail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    
+    if (toSubmit == 0) {
+        return 0;
+    }
+    
+    do {
+        rc = ringEnter(ring->fd, toSubmit, 0, 0);
+    } while (rc < 0 && errno == EINTR);
+    
+    return (rc < 0) ? -errno : rc;
+}
+
+/**
+ * Bir tamamlanma kaydı bekler
+ */
+ErrorCode waitIoRingCompletion(IoRing* ring, struct io_uring_cqe* cqe) {
+    for (;;) {
+        unsigned head = *ring->cqHead;
+        unsigned tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+        
+        if (head != tail) {
+            *cqe = ring->cqes[head & *ring->cqMask];
+            __atomic_store_n(ring->cqHead, head + 1, __ATOMIC_RELEASE);
+            return SUCCESS;
+        }
+        
+        if (ringEnter(ring->fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) {
+            return ERROR_UNKNOWN;
+        }
+    }
+}
+
+/**
+ * Halkayı kapatır
+ */
+void destroyIoRing(IoRing* ring) {
+    if (ring == NULL) {
+        return;
+    }
+    
+    if (ring->sqes != MAP_FAILED) {
+        munmap(ring->sqes, ring->sqesSize);
+    }
+    if (ring->cqMap != MAP_FAILED && ring->cqMap != ring->sqMap) {
+        munmap(ring->cqMap, ring->cqMapSize);
+    }
+    if (ring->sqMap != MAP_FAILED) {
+        munmap(ring->sqMap, ring->sqMapSize);
+    }
+    close(ring->fd);
+    free(ring);
+}
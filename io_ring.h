@@ -0,0 +1,78 @@
+/**
+ * io_ring.h
+ * io_uring halkası için ince sarmalayıcı fonksiyon tanımlamaları
+ *
+ * liburing kullanılmaz; halka doğrudan io_uring_setup/io_uring_enter sistem
+ * çağrıları ve paylaşılan bellek ile yönetilir. Tek iş parçacığından
+ * kullanılmak üzere tasarlanmıştır.
+ */
+
+#ifndef IO_RING_H
+#define IO_RING_H
+
+#include "file_system.h"
+#include <linux/io_uring.h>
+
+typedef struct IoRing IoRing;
+
+/**
+ * Halkayı oluşturur, gereken işlemlerin çekirdekte desteklendiğini doğrular
+ * ve seyrek bir sabit dosya tablosu kaydeder
+ *
+ * @param entries Gönderim kuyruğu boyutu
+ * @param fileSlots Sabit dosya tablosundaki yuva sayısı (0: tablo kaydedilmez).
+ *                  Tablo kaydedilecekse çekirdeğin zincirlenen isteklerin sabit
+ *                  dosyalarını çalıştırma anında çözmesi (IORING_FEAT_LINKED_FILE) gerekir.
+ * @param ops Gereken IORING_OP_* işlemleri
+ * @param opCount İşlem sayısı
+ * @param ring Oluşturulan halka
+ * @return Başarı durumu (io_uring yoksa veya işlemler desteklenmiyorsa hata)
+ */
+ErrorCode createIoRing(unsigned entries, unsigned fileSlots, const unsigned char* ops, int opCount, IoRing** ring);
+
+/**
+ * Sabit dosya tablosunun yuvalarına dosya tanımlayıcıları yerleştirir
+ * (IORING_REGISTER_FILES_UPDATE). Halka tanımlayıcıların kendi kopyasını
+ * tutar; çağıran kendi tanımlayıcılarını kapatabilir.
+ *
+ * @param ring Halka
+ * @param offset İlk yuva
+ * @param fds Yerleştirilecek tanımlayıcılar (-1: yuvayı boşalt)
+ * @param count Tanımlayıcı sayısı
+ * @return Başarı durumu
+ */
+ErrorCode updateIoRingFiles(IoRing* ring, unsigned offset, const int* fds, unsigned count);
+
+/**
+ * Doldurulmak üzere sıfırlanmış bir gönderim girdisi döndürür
+ *
+ * @param ring Halka
+ * @return Girdi, kuyruk doluysa NULL
+ */
+struct io_uring_sqe* getIoRingSqe(IoRing* ring);
+
+/**
+ * Hazırlanan girdileri çekirdeğe gönderir
+ *
+ * @param ring Halka
+ * @return Gönderilen girdi sayısı, hata durumunda -errno
+ */
+int submitIoRing(IoRing* ring);
+
+/**
+ * Bir tamamlanma kaydı gelene kadar bekler ve kuyruktan alır
+ *
+ * @param ring Halka
+ * @param cqe Alınan kaydın kopyası
+ * @return Başarı durumu
+ */
+ErrorCode waitIoRingCompletion(IoRing* ring, struct io_uring_cqe* cqe);
+
+/**
+ * Halkayı kapatır ve belleği serbest bırakır
+ *
+ * @param ring Halka (NULL olabilir)
+ */
+void destroyIoRing(IoRing* ring);
+
+#endif /* IO_RING_H */
@@ -0,0 +1,27 @@
+/**
+ * libfilesystem.h
+ * Kütüphane olarak kullanım için toplu başlık dosyası
+ *
+ * Dosya ve dizin işlemleri libfilesystem.a / libfilesystem.so olarak derlenir.
+ * Geri çağırma (callback) veya buffer alan fonksiyonlar (listDirEntries,
+ * listFilesByExtensionEntries, readFileChunks, readFileToBuffer, readLogs)
+ * standart çıktıya yazmaz, fork yapmaz ve birden fazla iş parçacığından
+ * güvenle çağrılabilir. Sonuç her zaman ErrorCode olarak döndürülür.
+ */
+
+#ifndef LIBFILESYSTEM_H
+#define LIBFILESYSTEM_H
+
+#include "file_system.h"
+#include "file_operations.h"
+#include "directory_operations.h"
+#include "file_matcher.h"
+#include "content_search.h"
+#include "checksum.h"
+#include "logger.h"
+#include "log_segments.h"
+#include "extension_index.h"
+#include "executor.h"
+#include "utils.h"
+
+#endif /* LIBFILESYSTEM_H */
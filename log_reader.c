@@ -0,0 +1,588 @@
+/**
+ * log_reader.c
+ * Log kayıtlarını okuma, filtreleme ve görüntüleme fonksiyonlarının implementasyonları
+ *
+ * Filtreli sorgularda log dosyası mmap ile eşlenir. Kayıtlar zaman sırasıyla
+ * eklendiği için --since başlangıcı ikili arama ile bulunur: rastgele bir
+ * konumdan sonraki ilk kayıt sınırına (metinde satır başı, ikili logda
+ * doğrulanmış başlık) ilerlenir ve zaman damgası karşılaştırılır. Döndürülmüş
+ * parçalardan yalnızca zaman aralığı sorguyla kesişenler açılır.
+ */
+
+#define _GNU_SOURCE
+#include "logger.h"
+#include "log_segments.h"
+#include "utils.h"
+#include <limits.h>
+#include <sys/mman.h>
+
+#define LOG_RENDER_BUFFER_SIZE 65536
+#define LOG_SEARCH_LINEAR_WINDOW 4096
+#define LOG_TIMESTAMP_LENGTH 19     // "YYYY-MM-DD HH:MM:SS"
+
+/**
+ * Metne dönüştürülen kayıtların biriktirildiği çıktı buffer'ı
+ */
+typedef struct {
+    DataChunkCallback callback;
+    void* userData;
+    int stopped;            // Geri çağırma fonksiyonu durdurulmasını istedi
+    int finished;           // --until aşıldı veya --limit doldu
+    int printed;            // Şimdiye kadar iletilen kayıt sayısı
+    size_t used;
+    char buffer[LOG_RENDER_BUFFER_SIZE];
+} LogOutput;
+
+/**
+ * Biriken çıktıyı geri çağırma fonksiyonuna iletir
+ */
+static void flushOutput(LogOutput* out) {
+    if (out->used > 0 && !out->stopped) {
+        out->stopped = (out->callback(out->buffer, out->used, out->userData) != 0);
+    }
+    out->used = 0;
+}
+
+/**
+ * Çıktı buffer'ına veri ekler
+ */
+static void appendOutput(LogOutput* out, const char* data, size_t length) {
+    if (out->used + length > sizeof(out->buffer)) {
+        flushOutput(out);
+    }
+    if (length > sizeof(out->buffer)) {
+        if (!out->stopped) {
+            out->stopped = (out->callback(data, length, out->userData) != 0);
+        }
+        return;
+    }
+    memcpy(out->buffer + out->used, data, length);
+    out->used += length;
+}
+
+/**
+ * Nanosaniye zaman damgasını log dosyasındaki yerel saat biçimine çevirir
+ */
+static void formatTimestampNs(long long ns, char* buffer, size_t size) {
+    time_t seconds = (time_t)(ns / 1000000000LL);
+    struct tm tmBuffer;
+    
+    localtime_r(&seconds, &tmBuffer);
+    strftime(buffer, size, "%Y-%m-%d %H:%M:%S", &tmBuffer);
+}
+
+/**
+ * Sorguda filtre olup olmadığını kontrol eder
+ */
+static int hasFilters(const LogQuery* query) {
+    return query != NULL &&
+           (query->sinceNs > 0 || query->untilNs > 0 || query->type >= 0 || query->limit > 0);
+}
+
+/**
+ * Açık log dosyasını salt okunur eşler
+ * 
+ * @return Başarı durumu; boş dosyada *data NULL ve *size 0 olur
+ */
+static ErrorCode mapLogFile(int fd, const char** data, size_t* size) {
+    struct stat st;
+    
+    *data = NULL;
+    *size = 0;
+    
+    if (fstat(fd, &st) == -1) {
+        return ERROR_UNKNOWN;
+    }
+    if (st.st_size == 0) {
+        return SUCCESS;
+    }
+    
+    void* mapped = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+        return ERROR_UNKNOWN;
+    }
+    
+    *data = mapped;
+    *size = (size_t)st.st_size;
+    return SUCCESS;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Metin log                                                               */
+/* ---------------------------------------------------------------------- */
+
+/**
+ * Verilen konumdan itibaren ilk satır başını bulur
+ */
+static size_t nextLineStart(const char* data, size_t size, size_t offset) {
+    if (offset == 0) {
+        return 0;
+    }
+    const char* newline = memchr(data + offset - 1, '\n', size - offset + 1);
+    return (newline == NULL) ? size : (size_t)(newline - data) + 1;
+}
+
+/**
+ * Satırın zaman damgasını döndürür ("[YYYY-MM-DD HH:MM:SS] ..." biçimi)
+ * 
+ * @return Zaman damgasının başı, biçim uymuyorsa NULL
+ */
+static const char* lineTimestamp(const char* line, size_t length) {
+    if (length < LOG_TIMESTAMP_LENGTH + 2 || line[0] != '[' || line[LOG_TIMESTAMP_LENGTH + 1] != ']') {
+        return NULL;
+    }
+    return line + 1;
+}
+
+/**
+ * Satırdaki yerel saat zaman damgasını nanosaniyeye çevirir
+ * 
+ * @return Zaman, çözülemezse 0
+ */
+static long long textTimestampNs(const char* ts) {
+    char text[LOG_TIMESTAMP_LENGTH + 1];
+    struct tm tmValue;
+    
+    memcpy(text, ts, LOG_TIMESTAMP_LENGTH);
+    text[LOG_TIMESTAMP_LENGTH] = '\0';
+    memset(&tmValue, 0, sizeof(tmValue));
+    
+    char* end = strptime(text, "%Y-%m-%d %H:%M:%S", &tmValue);
+    if (end == NULL || *end != '\0') {
+        return 0;
+    }
+    tmValue.tm_isdst = -1;
+    
+    time_t seconds = mktime(&tmValue);
+    return (seconds > 0) ? (long long)seconds * 1000000000LL : 0;
+}
+
+/**
+ * Zaman damgası since değerinden küçük olmayan ilk satırı bulur
+ */
+static size_t findFirstTextLine(const char* data, size_t size, const char* since) {
+    size_t lo = 0;
+    size_t hi = size;
+    
+    while (hi - lo > LOG_SEARCH_LINEAR_WINDOW) {
+        size_t line = nextLineStart(data, size, lo + (hi - lo) / 2);
+        if (line >= hi) {
+            break;
+        }
+        const char* end = memchr(data + line, '\n', size - line);
+        size_t length = (end == NULL) ? size - line : (size_t)(end - (data + line));
+        const char* ts = lineTimestamp(data + line, length);
+        if (ts == NULL) {
+            break;
+        }
+        if (memcmp(ts, since, LOG_TIMESTAMP_LENGTH) < 0) {
+            lo = line + length + (end != NULL);
+        } else {
+            hi = line;
+        }
+    }
+    
+    // Kalan küçük aralıkta doğrusal arama
+    while (lo < size) {
+        const char* end = memchr(data + lo, '\n', size - lo);
+        size_t length = (end == NULL) ? size - lo : (size_t)(end - (data + lo));
+        const char* ts = lineTimestamp(data + lo, length);
+        if (ts != NULL && memcmp(ts, since, LOG_TIMESTAMP_LENGTH) >= 0) {
+            break;
+        }
+        lo += length + (end != NULL);
+    }
+    
+    return lo;
+}
+
+/**
+ * Metin log verisini filtreleyerek iletir
+ */
+static void queryTextData(const char* data, size_t size, const LogQuery* query, LogOutput* out) {
+    char since[32] = "";
+    char until[32] = "";
+    char typeTag[16] = "";
+    size_t typeTagLength = 0;
+    
+    if (query->sinceNs > 0) {
+        formatTimestampNs(query->sinceNs, since, sizeof(since));
+    }
+    if (query->untilNs > 0) {
+        formatTimestampNs(query->untilNs, until, sizeof(until));
+    }
+    if (query->type >= 0) {
+        typeTagLength = (size_t)string_format(typeTag, sizeof(typeTag), "] [%s]", getLogTypeName(query->type));
+    }
+    
+    size_t pos = (since[0] != '\0') ? findFirstTextLine(data, size, since) : 0;
+    
+    while (pos < size && !out->stopped) {
+        const char* end = memchr(data + pos, '\n', size - pos);
+        size_t length = (end == NULL) ? size - pos : (size_t)(end - (data + pos)) + 1;
+        const char* line = data + pos;
+        const char* ts = lineTimestamp(line, length);
+        pos += length;
+        
+        if (until[0] != '\0' && ts != NULL && memcmp(ts, until, LOG_TIMESTAMP_LENGTH) > 0) {
+            out->finished = 1;
+            break;
+        }
+        if (typeTagLength > 0 &&
+            (ts == NULL || length < LOG_TIMESTAMP_LENGTH + 1 + typeTagLength ||
+             memcmp(line + LOG_TIMESTAMP_LENGTH + 1, typeTag, typeTagLength) != 0)) {
+            continue;
+        }
+        
+        appendOutput(out, line, length);
+        if (query->limit > 0 && ++out->printed >= query->limit) {
+            out->finished = 1;
+            break;
+        }
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* İkili log                                                               */
+/* ---------------------------------------------------------------------- */
+
+/**
+ * Konumda geçerli bir ikili kayıt olup olmadığını kontrol eder
+ * 
+ * @return Kaydın toplam uzunluğu, geçerli değilse 0
+ */
+static size_t binaryRecordAt(const char* data, size_t size, size_t offset, BinaryLogHeader* header) {
+    if (offset + sizeof(*header) > size) {
+        return 0;
+    }
+    
+    memcpy(header, data + offset, sizeof(*header));
+    if (header->magic != LOG_BINARY_MAGIC || header->check != binaryLogCheck(header)) {
+        return 0;
+    }
+    
+    // Yazıcı yolu MAX_CONTENT_LENGTH altında keser; daha uzunu bozuk kayıttır
+    if (header->pathLength >= MAX_CONTENT_LENGTH) {
+        return 0;
+    }
+    
+    size_t total = (sizeof(*header) + header->pathLength + LOG_BINARY_ALIGNMENT - 1) &
+                   ~(size_t)(LOG_BINARY_ALIGNMENT - 1);
+    return (offset + total <= size) ? total : 0;
+}
+
+/**
+ * Verilen konumdan itibaren ilk geçerli kaydı bulur
+ */
+static size_t nextBinaryRecord(const char* data, size_t size, size_t offset, BinaryLogHeader* header) {
+    offset &= ~(size_t)(LOG_BINARY_ALIGNMENT - 1);
+    
+    while (offset < size && binaryRecordAt(data, size, offset, header) == 0) {
+        offset += LOG_BINARY_ALIGNMENT;
+    }
+    
+    return (offset < size) ? offset : size;
+}
+
+/**
+ * Zaman damgası since değerinden küçük olmayan ilk kaydı bulur
+ */
+static size_t findFirstBinaryRecord(const char* data, size_t size, long long sinceNs) {
+    BinaryLogHeader header;
+    size_t lo = 0;
+    size_t hi = size;
+    
+    while (hi - lo > LOG_SEARCH_LINEAR_WINDOW) {
+        size_t record = nextBinaryRecord(data, size, lo + (hi - lo) / 2, &header);
+        if (record >= hi) {
+            break;
+        }
+        if ((long long)header.timestampNs < sinceNs) {
+            lo = record + binaryRecordAt(data, size, record, &header);
+        } else {
+            hi = record;
+        }
+    }
+    
+    // Kalan küçük aralıkta doğrusal arama
+    for (lo = nextBinaryRecord(data, size, lo, &header); lo < size;
+         lo = nextBinaryRecord(data, size, lo + binaryRecordAt(data, size, lo, &header), &header)) {
+        if ((long long)header.timestampNs >= sinceNs) {
+            break;
+        }
+    }
+    
+    return lo;
+}
+
+/**
+ * İkili log verisini filtreleyerek metne dönüştürür ve iletir
+ */
+static void queryBinaryData(const char* data, size_t size, const LogQuery* query, LogOutput* out) {
+    BinaryLogHeader header;
+    char path[MAX_CONTENT_LENGTH];
+    char message[MAX_CONTENT_LENGTH];
+    char line[MAX_CONTENT_LENGTH + 64];
+    char timeBuffer[32] = "";
+    long long cachedSecond = -1;
+    
+    size_t pos = (query->sinceNs > 0) ? findFirstBinaryRecord(data, size, query->sinceNs)
+                                      : nextBinaryRecord(data, size, 0, &header);
+    
+    while (pos < size && !out->stopped) {
+        size_t total = binaryRecordAt(data, size, pos, &header);
+        if (total == 0) {
+            pos = nextBinaryRecord(data, size, pos + LOG_BINARY_ALIGNMENT, &header);
+            continue;
+        }
+        const char* recordPath = data + pos + sizeof(header);
+        pos += total;
+        
+        if (query->untilNs > 0 && (long long)header.timestampNs > query->untilNs) {
+            out->finished = 1;
+            break;
+        }
+        if (query->type >= 0 && header.type != query->type) {
+            continue;
+        }
+        
+        // Metin yalnızca burada, görüntülenirken üretilir
+        long long second = (long long)(header.timestampNs / 1000000000ULL);
+        if (second != cachedSecond) {
+            formatTimestampNs((long long)header.timestampNs, timeBuffer, sizeof(timeBuffer));
+            cachedSecond = second;
+        }
+        memcpy(path, recordPath, header.pathLength);
+        path[header.pathLength] = '\0';
+        string_format(message, sizeof(message), getLogOperationTemplate(header.operation), path);
+        int length = string_format(line, sizeof(line), "[%s] [%s] %s\n", timeBuffer, getLogTypeName(header.type), message);
+        appendOutput(out, line, (size_t)length);
+        
+        if (query->limit > 0 && ++out->printed >= query->limit) {
+            out->finished = 1;
+            break;
+        }
+    }
+}
+
+/**
+ * Log verisindeki ilk ve son kaydın zaman damgasını bulur
+ */
+void getLogTimeRange(LogFormat format, const char* data, size_t size, long long* firstNs, long long* lastNs) {
+    *firstNs = 0;
+    *lastNs = LLONG_MAX;
+    
+    if (format == LOG_FORMAT_BINARY) {
+        BinaryLogHeader header;
+        size_t pos = nextBinaryRecord(data, size, 0, &header);
+        if (pos < size) {
+            *firstNs = (long long)header.timestampNs;
+        }
+        
+        // Kayıtlar bitişik olduğundan uzunluklar üzerinden sona yürü
+        while (pos < size) {
+            size_t total = binaryRecordAt(data, size, pos, &header);
+            if (total == 0) {
+                pos = nextBinaryRecord(data, size, pos + LOG_BINARY_ALIGNMENT, &header);
+                continue;
+            }
+            *lastNs = (long long)header.timestampNs;
+            pos += total;
+        }
+        return;
+    }
+    
+    // Metin: ilk satır ve son tam satır
+    const char* firstNewline = memchr(data, '\n', size);
+    if (firstNewline == NULL) {
+        return;
+    }
+    const char* ts = lineTimestamp(data, (size_t)(firstNewline - data));
+    if (ts != NULL) {
+        *firstNs = textTimestampNs(ts);
+    }
+    
+    const char* lastNewline = memrchr(data, '\n', size);
+    const char* lastLine = data;
+    if (lastNewline > data) {
+        const char* previous = memrchr(data, '\n', (size_t)(lastNewline - data));
+        if (previous != NULL) {
+            lastLine = previous + 1;
+        }
+    }
+    ts = lineTimestamp(lastLine, (size_t)(lastNewline - lastLine));
+    if (ts != NULL && textTimestampNs(ts) > 0) {
+        *lastNs = textTimestampNs(ts) + 999999999LL;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* Ortak arayüz                                                            */
+/* ---------------------------------------------------------------------- */
+
+/**
+ * Bellekteki log verisini sorguya göre iletir
+ */
+static void queryLogData(LogFormat format, const char* data, size_t size, const LogQuery* query, LogOutput* out) {
+    if (format == LOG_FORMAT_BINARY) {
+        queryBinaryData(data, size, query, out);
+    } else if (hasFilters(query)) {
+        queryTextData(data, size, query, out);
+    } else {
+        // Filtresiz metin log olduğu gibi aktarılır
+        flushOutput(out);
+        if (!out->stopped) {
+            out->stopped = (out->callback(data, size, out->userData) != 0);
+        }
+    }
+}
+
+/**
+ * Döndürülmüş parçalardan zaman aralığı sorguyla kesişenleri sırayla iletir
+ */
+static void querySegments(const LogSegment* segments, int count, LogFormat format,
+                          const LogQuery* query, LogOutput* out) {
+    for (int i = 0; i < count && !out->stopped && !out->finished; i++) {
+        const LogSegment* segment = &segments[i];
+        char* data;
+        
+        if (segment->format != format ||
+            (query->sinceNs > 0 && segment->lastNs < query->sinceNs) ||
+            (query->untilNs > 0 && segment->firstNs > query->untilNs)) {
+            continue;
+        }
+        
+        if (loadLogSegment(segment, &data) != SUCCESS) {
+            continue;
+        }
+        queryLogData(format, data, segment->rawSize, query, out);
+        free(data);
+    }
+}
+
+/**
+ * Filtreye uyan log kayıtlarını metin olarak parça parça iletir
+ */
+ErrorCode queryLogs(const LogQuery* query, DataChunkCallback callback, void* userData) {
+    static const LogQuery allRecords = { 0, 0, -1, 0 };
+    LogFormat format = getLogFormat();
+    LogSegment* segments = NULL;
+    int segmentCount = 0;
+    const char* data;
+    size_t size;
+    LogOutput* out;
+    
+    if (callback == NULL) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    if (query == NULL) {
+        query = &allRecords;
+    }
+    
+    // Parça listesi ve etkin dosya manifest kilidi altında birlikte alınır;
+    // kilit, çıktı yazılırken döndürmeyi bekletmemek için hemen bırakılır
+    int manifestFd = openLogManifest(0);
+    if (manifestFd != -1) {
+        readLogSegments(manifestFd, &segments, &segmentCount);
+    }
+    int fd = open(getLogFilePath(), O_RDONLY);
+    int openErrno = errno;
+    closeLogManifest(manifestFd);
+    
+    if (fd == -1) {
+        free(segments);
+        return (openErrno == ENOENT) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+    }
+    
+    ErrorCode result = mapLogFile(fd, &data, &size);
+    close(fd);
+    if (result != SUCCESS) {
+        free(segments);
+        return result;
+    }
+    
+    out = malloc(sizeof(LogOutput));
+    if (out == NULL) {
+        if (data != NULL) {
+            munmap((void*)data, size);
+        }
+        free(segments);
+        return ERROR_UNKNOWN;
+    }
+    out->callback = callback;
+    out->userData = userData;
+    out->stopped = 0;
+    out->finished = 0;
+    out->printed = 0;
+    out->used = 0;
+    
+    querySegments(segments, segmentCount, format, query, out);
+    if (data != NULL) {
+        if (!out->stopped && !out->finished) {
+            queryLogData(format, data, size, query, out);
+        }
+        munmap((void*)data, size);
+    }
+    
+    flushOutput(out);
+    free(out);
+    free(segments);
+    return SUCCESS;
+}
+
+/**
+ * Log kayıtlarını parça parça geri çağırma fonksiyonuna iletir
+ */
+ErrorCode readLogs(DataChunkCallback callback, void* userData) {
+    return queryLogs(NULL, callback, userData);
+}
+
+/**
+ * showLogs için okunan parçayı çıktıya yazar
+ */
+static int writeLogChunk(const char* data, size_t length, void* userData) {
+    (void)userData;
+    write(getOutputFd(), data, length);
+    return 0;
+}
+
+/**
+ * Filtreye uyan log kayıtlarını gösterir
+ */
+ErrorCode showLogsQuery(const LogQuery* query) {
+    ErrorCode result;
+    const char* header1 = "Log kayıtları:\n";
+    const char* header2 = "=========================================\n";
+    
+    // Log dosyasının varlığını kontrol et
+    if (!fileExists(getLogFilePath())) {
+        const char* error_msg = "Log dosyası mevcut değil.\n";
+        write(getOutputFd(), error_msg, strlen(error_msg));
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    // Log dosyasını oku ve yazdır
+    write(getOutputFd(), header1, strlen(header1));
+    write(getOutputFd(), header2, strlen(header2));
+    
+    result = queryLogs(query, writeLogChunk, NULL);
+    if (result != SUCCESS) {
+        const char* error_msg = "Log dosyası açılamadı.\n";
+        write(getOutputFd(), error_msg, strlen(error_msg));
+        return ERROR_UNKNOWN;
+    }
+    
+    write(getOutputFd(), header2, strlen(header2));
+    
+    // Başarı durumunu log dosyasına kaydet
+    logMessage(LOG_INFO, "Log kayıtları görüntülendi");
+    
+    return SUCCESS;
+}
+
+/**
+ * Log dosyasındaki tüm kayıtları gösterir
+ */
+ErrorCode showLogs() {
+    return showLogsQuery(NULL);
+}
@@ -0,0 +1,518 @@
+/**
+ * log_segments.c
+ * Log dosyası döndürme ve sıkıştırılmış log arşivlerinin implementasyonları
+ */
+
+#define _GNU_SOURCE
+#include "log_segments.h"
+#include "block_codec.h"
+#include "utils.h"
+#include <limits.h>
+#include <stdio.h>
+#include <sys/mman.h>
+
+#define LOG_ARCHIVE_OUTPUT_SIZE (1024 * 1024)
+#define LOG_MANIFEST_LINE_LENGTH 160
+
+/**
+ * Arşiv dosyası başlığı; ardından bloklar gelir
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t blockSize;
+} LogArchiveHeader;
+
+/**
+ * Arşiv bloğu başlığı; storedLength == rawLength ise blok sıkıştırılmamıştır
+ */
+typedef struct {
+    uint32_t rawLength;
+    uint32_t storedLength;
+} LogArchiveBlock;
+
+// Döndürme sınırları (--log-rotate-kb, --log-rotate-age)
+static long long rotateMaxBytes = 0;
+static int rotateMaxAge = 0;
+
+// Etkin dosyanın ilk kayıt zamanı (her yazmada dosyayı okumamak için)
+static dev_t cachedDevice;
+static ino_t cachedInode;
+static int64_t cachedCreatedNs;
+static long long cachedFirstNs = 0;
+
+/**
+ * Log döndürme sınırlarını ayarlar
+ */
+void setLogRotation(long long maxBytes, int maxAgeSeconds) {
+    rotateMaxBytes = (maxBytes > 0) ? maxBytes : 0;
+    rotateMaxAge = (maxAgeSeconds > 0) ? maxAgeSeconds : 0;
+}
+
+/**
+ * Tüm veriyi dosyaya yazar
+ */
+static ErrorCode writeAllFd(int fd, const char* data, size_t length) {
+    while (length > 0) {
+        ssize_t written = write(fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return ERROR_UNKNOWN;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+    return SUCCESS;
+}
+
+/**
+ * Manifest dosyasını açar ve kilitler
+ */
+int openLogManifest(int exclusive) {
+    struct flock fl;
+    int fd;
+    
+    fd = exclusive ? open(LOG_MANIFEST_FILE, O_RDWR | O_CREAT | O_APPEND, 0644)
+                   : open(LOG_MANIFEST_FILE, O_RDONLY);
+    if (fd == -1) {
+        return -1;
+    }
+    
+    fl.l_type = exclusive ? F_WRLCK : F_RDLCK;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = 0;
+    fl.l_len = 0;
+    
+    while (fcntl(fd, F_SETLKW, &fl) == -1) {
+        if (errno != EINTR) {
+            close(fd);
+            return -1;
+        }
+    }
+    
+    return fd;
+}
+
+/**
+ * Manifest kilidini kaldırır ve dosyayı kapatır
+ */
+void closeLogManifest(int fd) {
+    struct flock fl;
+    
+    if (fd == -1) {
+        return;
+    }
+    
+    fl.l_type = F_UNLCK;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = 0;
+    fl.l_len = 0;
+    fcntl(fd, F_SETLK, &fl);
+    close(fd);
+}
+
+/**
+ * Manifestteki parçaları sıra numarasına göre okur
+ */
+ErrorCode readLogSegments(int fd, LogSegment** segments, int* count) {
+    struct stat st;
+    char* text;
+    int capacity = 0;
+    
+    *segments = NULL;
+    *count = 0;
+    
+    if (fstat(fd, &st) == -1) {
+        return ERROR_UNKNOWN;
+    }
+    if (st.st_size == 0) {
+        return SUCCESS;
+    }
+    
+    text = malloc((size_t)st.st_size + 1);
+    if (text == NULL) {
+        return ERROR_UNKNOWN;
+    }
+    
+    ssize_t bytesRead = pread(fd, text, (size_t)st.st_size, 0);
+    if (bytesRead < 0) {
+        free(text);
+        return ERROR_UNKNOWN;
+    }
+    text[bytesRead] = '\0';
+    
+    // Satır biçimi: sıra biçim saklama ilkZaman sonZaman hamBoyut diskBoyutu
+    for (char* line = text; line != NULL && *line != '\0'; ) {
+        char* next = strchr(line, '\n');
+        if (next != NULL) {
+            *next++ = '\0';
+        }
+        
+        LogSegment segment;
+        char format[16];
+        char storage[8];
+        if (sscanf(line, "%u %15s %7s %lld %lld %lu %lu", &segment.seq, format, storage,
+                   &segment.firstNs, &segment.lastNs, &segment.rawSize, &segment.storedSize) == 7) {
+            segment.format = (strcmp(format, "binary") == 0) ? LOG_FORMAT_BINARY : LOG_FORMAT_TEXT;
+            segment.compressed = (strcmp(storage, "lz") == 0);
+            
+            if (*count == capacity) {
+                capacity = (capacity == 0) ? 16 : capacity * 2;
+                LogSegment* grown = realloc(*segments, sizeof(LogSegment) * (size_t)capacity);
+                if (grown == NULL) {
+                    free(text);
+                    free(*segments);
+                    *segments = NULL;
+                    *count = 0;
+                    return ERROR_UNKNOWN;
+                }
+                *segments = grown;
+            }
+            (*segments)[(*count)++] = segment;
+        }
+        
+        line = next;
+    }
+    
+    free(text);
+    return SUCCESS;
+}
+
+/**
+ * Parçanın dosya yolunu oluşturur
+ */
+void getLogSegmentPath(const LogSegment* segment, char* buffer, size_t size) {
+    string_format(buffer, size, "%s.%u%s",
+                  (segment->format == LOG_FORMAT_BINARY) ? LOG_BINARY_FILE : LOG_FILE,
+                  segment->seq, segment->compressed ? ".lz" : "");
+}
+
+/**
+ * Veriyi bloklar halinde sıkıştırarak arşiv dosyasına yazar
+ */
+static ErrorCode writeLogArchive(const char* path, const char* data, size_t size, unsigned long* storedSize) {
+    LogArchiveHeader header = { LOG_ARCHIVE_MAGIC, CODEC_BLOCK_SIZE };
+    ErrorCode result = SUCCESS;
+    size_t used = 0;
+    char* output;
+    int fd;
+    
+    output = malloc(LOG_ARCHIVE_OUTPUT_SIZE);
+    if (output == NULL) {
+        return ERROR_UNKNOWN;
+    }
+    
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+        free(output);
+        return ERROR_UNKNOWN;
+    }
+    
+    memcpy(output, &header, sizeof(header));
+    used = sizeof(header);
+    *storedSize = 0;
+    
+    for (size_t offset = 0; offset < size && result == SUCCESS; offset += CODEC_BLOCK_SIZE) {
+        size_t rawLength = (size - offset < CODEC_BLOCK_SIZE) ? size - offset : CODEC_BLOCK_SIZE;
+        
+        // Blok ve başlığı için yer aç
+        if (LOG_ARCHIVE_OUTPUT_SIZE - used < sizeof(LogArchiveBlock) + CODEC_BLOCK_SIZE) {
+            result = writeAllFd(fd, output, used);
+            *storedSize += used;
+            used = 0;
+        }
+        
+        LogArchiveBlock block;
+        char* payload = output + used + sizeof(block);
+        size_t storedLength = compressBlock(data + offset, rawLength, payload, rawLength);
+        if (storedLength == 0 || storedLength >= rawLength) {
+            memcpy(payload, data + offset, rawLength);
+            storedLength = rawLength;
+        }
+        
+        block.rawLength = (uint32_t)rawLength;
+        block.storedLength = (uint32_t)storedLength;
+        memcpy(output + used, &block, sizeof(block));
+        used += sizeof(block) + storedLength;
+    }
+    
+    if (result == SUCCESS) {
+        result = writeAllFd(fd, output, used);
+        *storedSize += used;
+    }
+    
+    // Ham parça ancak arşiv diske ulaştıktan sonra silinir
+    if (result == SUCCESS && fdatasync(fd) == -1) {
+        result = ERROR_UNKNOWN;
+    }
+    
+    close(fd);
+    free(output);
+    
+    if (result != SUCCESS) {
+        unlink(path);
+    }
+    return result;
+}
+
+/**
+ * Etkin dosyayı kapatır, arşivler ve manifeste ekler
+ */
+static ErrorCode archiveActiveSegment(int fd, const struct stat* st, LogFormat format) {
+    const char* activePath = (format == LOG_FORMAT_BINARY) ? LOG_BINARY_FILE : LOG_FILE;
+    char rawPath[MAX_PATH_LENGTH];
+    char archivePath[MAX_PATH_LENGTH];
+    char line[LOG_MANIFEST_LINE_LENGTH];
+    LogSegment* segments;
+    LogSegment segment;
+    struct stat pathSt;
+    int count;
+    
+    int manifestFd = openLogManifest(1);
+    if (manifestFd == -1) {
+        return ERROR_UNKNOWN;
+    }
+    
+    // Dosya bu arada başka bir süreç tarafından döndürülmüş olabilir
+    if (stat(activePath, &pathSt) == -1 || pathSt.st_dev != st->st_dev || pathSt.st_ino != st->st_ino) {
+        closeLogManifest(manifestFd);
+        return SUCCESS;
+    }
+    
+    if (readLogSegments(manifestFd, &segments, &count) != SUCCESS) {
+        closeLogManifest(manifestFd);
+        return ERROR_UNKNOWN;
+    }
+    
+    memset(&segment, 0, sizeof(segment));
+    segment.seq = 1;
+    for (int i = 0; i < count; i++) {
+        if (segments[i].seq >= segment.seq) {
+            segment.seq = segments[i].seq + 1;
+        }
+    }
+    free(segments);
+    
+    segment.format = format;
+    segment.rawSize = (unsigned long)st->st_size;
+    getLogSegmentPath(&segment, rawPath, sizeof(rawPath));
+    segment.compressed = 1;
+    getLogSegmentPath(&segment, archivePath, sizeof(archivePath));
+    
+    // Yeni kayıtlar bundan sonra yeni etkin dosyaya yazılır; eski tanımlayıcıyı
+    // tutan yazıcılar kilidi aldıklarında dosyanın değiştiğini görür
+    if (rename(activePath, rawPath) == -1) {
+        closeLogManifest(manifestFd);
+        return ERROR_UNKNOWN;
+    }
+    cachedFirstNs = 0;
+    
+    // Aynı dosyaya ikinci bir tanımlayıcı açılıp kapatılırsa fcntl kilidi düşeceğinden
+    // parça yazıcının kendi tanımlayıcısı üzerinden okunur
+    void* data = mmap(NULL, (size_t)st->st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        segment.compressed = 0;
+        segment.storedSize = segment.rawSize;
+        segment.firstNs = 0;
+        segment.lastNs = LLONG_MAX;
+    } else {
+        madvise(data, (size_t)st->st_size, MADV_SEQUENTIAL);
+        getLogTimeRange(format, data, (size_t)st->st_size, &segment.firstNs, &segment.lastNs);
+        if (writeLogArchive(archivePath, data, (size_t)st->st_size, &segment.storedSize) != SUCCESS) {
+            segment.compressed = 0;
+            segment.storedSize = segment.rawSize;
+        }
+        munmap(data, (size_t)st->st_size);
+    }
+    
+    int length = string_format(line, sizeof(line), "%u %s %s %lld %lld %lu %lu\n", segment.seq,
+                               (format == LOG_FORMAT_BINARY) ? "binary" : "text",
+                               segment.compressed ? "lz" : "raw", segment.firstNs, segment.lastNs,
+                               segment.rawSize, segment.storedSize);
+    ErrorCode result = writeAllFd(manifestFd, line, (size_t)length);
+    
+    if (result == SUCCESS && segment.compressed) {
+        unlink(rawPath);
+    }
+    
+    closeLogManifest(manifestFd);
+    return result;
+}
+
+/**
+ * Dosyanın oluşturulma zamanını döndürür. Silinen dosyanın inode numarası
+ * yeni dosyaya verilebildiğinden önbellek yalnızca inode ile eşleştirilmez.
+ * Dosya sistemi oluşturulma zamanını vermiyorsa ctime kullanılır; bu durumda
+ * önbellek her yazmada yenilenir.
+ */
+static int64_t fileCreatedNs(int fd, const struct stat* st) {
+    struct statx stx;
+    
+    if (statx(fd, "", AT_EMPTY_PATH, STATX_BTIME, &stx) == 0 && (stx.stx_mask & STATX_BTIME)) {
+        return (int64_t)stx.stx_btime.tv_sec * 1000000000LL + stx.stx_btime.tv_nsec;
+    }
+    return timespecToNs(&st->st_ctim);
+}
+
+/**
+ * Etkin dosyadaki ilk kaydın zamanını döndürür
+ */
+static long long activeSegmentStart(int fd, const struct stat* st, LogFormat format) {
+    char buffer[64];
+    long long firstNs;
+    long long lastNs;
+    int64_t createdNs = fileCreatedNs(fd, st);
+    
+    if (cachedFirstNs != 0 && cachedDevice == st->st_dev && cachedInode == st->st_ino &&
+        cachedCreatedNs == createdNs) {
+        return cachedFirstNs;
+    }
+    
+    ssize_t bytesRead = pread(fd, buffer, sizeof(buffer), 0);
+    if (bytesRead <= 0) {
+        return 0;
+    }
+    
+    // Yalnızca ilk kayıt gerekir; kısa buffer son kaydı kesik gösterebilir
+    getLogTimeRange(format, buffer, (size_t)bytesRead, &firstNs, &lastNs);
+    if (firstNs > 0) {
+        cachedDevice = st->st_dev;
+        cachedInode = st->st_ino;
+        cachedCreatedNs = createdNs;
+        cachedFirstNs = firstNs;
+    }
+    return firstNs;
+}
+
+/**
+ * Etkin log dosyası sınırları aştıysa dosyayı döndürür ve arşivler
+ */
+ErrorCode rotateLogIfNeeded(int fd, LogFormat format) {
+    struct stat st;
+    ErrorCode result = SUCCESS;
+    int due;
+    
+    if (rotateMaxBytes == 0 && rotateMaxAge == 0) {
+        return SUCCESS;
+    }
+    
+    if (fstat(fd, &st) == -1) {
+        return ERROR_UNKNOWN;
+    }
+    if (st.st_size == 0) {
+        return SUCCESS;
+    }
+    
+    due = (rotateMaxBytes > 0 && st.st_size >= rotateMaxBytes);
+    if (!due && rotateMaxAge > 0) {
+        long long firstNs = activeSegmentStart(fd, &st, format);
+        due = (firstNs > 0 && (long long)time(NULL) - firstNs / 1000000000LL >= rotateMaxAge);
+    }
+    
+    if (due) {
+        result = archiveActiveSegment(fd, &st, format);
+    }
+    
+    return result;
+}
+
+/**
+ * Parçayı belleğe açar
+ */
+ErrorCode loadLogSegment(const LogSegment* segment, char** data) {
+    char path[MAX_PATH_LENGTH];
+    struct stat st;
+    char* stored;
+    char* raw;
+    int fd;
+    
+    *data = NULL;
+    getLogSegmentPath(segment, path, sizeof(path));
+    
+    fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        return (errno == ENOENT) ? ERROR_FILE_NOT_FOUND : ERROR_UNKNOWN;
+    }
+    if (fstat(fd, &st) == -1) {
+        close(fd);
+        return ERROR_UNKNOWN;
+    }
+    
+    raw = malloc(segment->rawSize + 1);
+    stored = segment->compressed ? malloc((size_t)st.st_size + 1) : raw;
+    if (raw == NULL || stored == NULL) {
+        free(raw);
+        close(fd);
+        return ERROR_UNKNOWN;
+    }
+    
+    // Dosyanın tamamını oku
+    size_t expected = segment->compressed ? (size_t)st.st_size : segment->rawSize;
+    size_t total = 0;
+    while (total < expected) {
+        ssize_t bytesRead = read(fd, stored + total, expected - total);
+        if (bytesRead < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytesRead <= 0) {
+            break;
+        }
+        total += (size_t)bytesRead;
+    }
+    close(fd);
+    
+    ErrorCode result = (total == expected) ? SUCCESS : ERROR_UNKNOWN;
+    
+    // Blokları sırayla aç
+    if (result == SUCCESS && segment->compressed) {
+        LogArchiveHeader header;
+        size_t in = sizeof(header);
+        size_t out = 0;
+        
+        if (total < sizeof(header)) {
+            result = ERROR_UNKNOWN;
+        } else {
+            memcpy(&header, stored, sizeof(header));
+            if (header.magic != LOG_ARCHIVE_MAGIC) {
+                result = ERROR_UNKNOWN;
+            }
+        }
+        
+        while (result == SUCCESS && in < total) {
+            LogArchiveBlock block;
+            if (total - in < sizeof(block)) {
+                result = ERROR_UNKNOWN;
+                break;
+            }
+            memcpy(&block, stored + in, sizeof(block));
+            in += sizeof(block);
+            
+            if (block.storedLength > total - in || block.rawLength > segment->rawSize - out ||
+                block.storedLength > block.rawLength) {
+                result = ERROR_UNKNOWN;
+                break;
+            }
+            if (block.storedLength == block.rawLength) {
+                memcpy(raw + out, stored + in, block.rawLength);
+            } else {
+                result = decompressBlock(stored + in, block.storedLength, raw + out, block.rawLength);
+            }
+            in += block.storedLength;
+            out += block.rawLength;
+        }
+        
+        if (result == SUCCESS && out != segment->rawSize) {
+            result = ERROR_UNKNOWN;
+        }
+        free(stored);
+    }
+    
+    if (result != SUCCESS) {
+        free(raw);
+        return result;
+    }
+    
+    *data = raw;
+    return SUCCESS;
+}
@@ -0,0 +1,94 @@
+/**
+ * log_segments.h
+ * Log dosyası döndürme ve sıkıştırılmış log arşivleri için fonksiyon tanımlamaları
+ *
+ * Etkin log dosyası (log.txt / log.bin) boyut veya yaş sınırını aştığında
+ * "<dosya>.<sıra>" adıyla kapatılır, blok sıkıştırıcı ile "<dosya>.<sıra>.lz"
+ * arşivine dönüştürülür ve log.manifest dosyasına zaman aralığıyla birlikte
+ * kaydedilir. showLogs yalnızca istenen zaman aralığıyla kesişen arşivleri açar.
+ */
+
+#ifndef LOG_SEGMENTS_H
+#define LOG_SEGMENTS_H
+
+#include "logger.h"
+
+#define LOG_MANIFEST_FILE "log.manifest"
+#define LOG_ARCHIVE_MAGIC 0x5A4C5346u   // "FSLZ"
+
+/**
+ * Manifest kaydı: kapatılmış bir log parçası
+ */
+typedef struct {
+    unsigned seq;               // Parça sıra numarası (tüm biçimler için ortak)
+    LogFormat format;
+    int compressed;             // 0: Sıkıştırma başarısız oldu, parça ham saklanıyor
+    long long firstNs;          // İlk kaydın zaman damgası
+    long long lastNs;           // Son kaydın zaman damgası
+    unsigned long rawSize;      // Açılmış boyut
+    unsigned long storedSize;   // Diskteki boyut
+} LogSegment;
+
+/**
+ * Log döndürme sınırlarını ayarlar
+ * 
+ * @param maxBytes Etkin dosyanın en fazla boyutu (0: sınır yok)
+ * @param maxAgeSeconds Etkin dosyadaki ilk kaydın en fazla yaşı (0: sınır yok)
+ */
+void setLogRotation(long long maxBytes, int maxAgeSeconds);
+
+/**
+ * Etkin log dosyası sınırları aştıysa dosyayı döndürür ve arşivler.
+ * Çağıran, okuma-yazma açılmış fd üzerinde yazma kilidini ve süreç içindeki
+ * log yazma kilidini tutuyor olmalıdır.
+ * 
+ * @param fd Etkin log dosyasının tanımlayıcısı
+ * @param format Log biçimi
+ * @return Başarı durumu
+ */
+ErrorCode rotateLogIfNeeded(int fd, LogFormat format);
+
+/**
+ * Manifest dosyasını açar ve kilitler
+ * 
+ * @param exclusive 1: Yazma kilidi (dosya yoksa oluşturulur), 0: Okuma kilidi
+ * @return Dosya tanımlayıcısı, manifest yoksa veya açılamazsa -1
+ */
+int openLogManifest(int exclusive);
+
+/**
+ * Manifest kilidini kaldırır ve dosyayı kapatır
+ * 
+ * @param fd openLogManifest ile açılan tanımlayıcı
+ */
+void closeLogManifest(int fd);
+
+/**
+ * Manifestteki parçaları sıra numarasına göre okur
+ * 
+ * @param fd openLogManifest ile açılan tanımlayıcı
+ * @param segments Parça dizisi (çağıran free ile serbest bırakır)
+ * @param count Parça sayısı
+ * @return Başarı durumu
+ */
+ErrorCode readLogSegments(int fd, LogSegment** segments, int* count);
+
+/**
+ * Parçanın dosya yolunu oluşturur
+ * 
+ * @param segment Parça
+ * @param buffer Yolun yazılacağı buffer
+ * @param size Buffer boyutu
+ */
+void getLogSegmentPath(const LogSegment* segment, char* buffer, size_t size);
+
+/**
+ * Parçayı belleğe açar
+ * 
+ * @param segment Parça
+ * @param data rawSize baytlık veri (çağıran free ile serbest bırakır)
+ * @return Başarı durumu
+ */
+ErrorCode loadLogSegment(const LogSegment* segment, char** data);
+
+#endif /* LOG_SEGMENTS_H */
@@ -5,6 +5,160 @@
 
 #include "logger.h"
 #include "utils.h"
+#include "shm_log.h"
+#include "log_segments.h"
+#include <pthread.h>
+
+// Oturum boyunca açık tutulan log dosyası tanımlayıcısı (-1: oturum yok)
+static int sessionLogFd = -1;
+
+// Klasik fcntl kilitleri süreç başınadır: aynı süreçteki iş parçacıklarını
+// dışlamaz ve bir iş parçacığının F_UNLCK çağrısı diğerinin kilidini de
+// kaldırır. Bu nedenle kilitleme, yazma ve döndürme bu mutex altında yapılır.
+static pthread_mutex_t logWriteLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Yazılan log kayıtlarının biçimi (--log-format)
+static LogFormat logFormat = LOG_FORMAT_TEXT;
+
+// İşlem kodlarının metin şablonları (LogOperation sırasıyla)
+static const char* operationTemplates[OP_COUNT] = {
+    [OP_MESSAGE] = "%s",
+    [OP_DIR_EXISTS] = "Dizin veya dosya zaten mevcut: %s",
+    [OP_DIR_CREATE_ERROR] = "Dizin oluşturma hatası: %s",
+    [OP_DIR_CREATED] = "Dizin oluşturuldu: %s",
+    [OP_DIR_NOT_FOUND] = "Dizin bulunamadı: %s",
+    [OP_DIR_LISTED] = "Dizin listelendi: %s",
+    [OP_DIR_LIST_ERROR] = "Dizin listeleme hatası: %s",
+    [OP_EXTENSION_LISTED] = "Uzantıya göre dosyalar listelendi: %s",
+    [OP_EXTENSION_LIST_ERROR] = "Uzantıya göre listeleme hatası: %s",
+    [OP_DIR_NOT_EMPTY] = "Dizin boş değil: %s",
+    [OP_DIR_DELETED] = "Dizin silindi: %s",
+    [OP_DIR_DELETE_ERROR] = "Dizin silme hatası: %s",
+    [OP_FORK_ERROR] = "Fork hatası: %s",
+    [OP_FILE_EXISTS] = "Dosya zaten mevcut: %s",
+    [OP_FILE_CREATE_ERROR] = "Dosya oluşturma hatası: %s",
+    [OP_FILE_CREATED] = "Dosya oluşturuldu: %s",
+    [OP_FILE_NOT_FOUND] = "Dosya bulunamadı: %s",
+    [OP_FILE_OPEN_ERROR] = "Dosya açma hatası: %s",
+    [OP_FILE_WRITE_ERROR] = "Dosyaya yazma hatası: %s",
+    [OP_FILE_READ] = "Dosya okundu: %s",
+    [OP_FILE_READ_ERROR] = "Dosya okuma hatası: %s",
+    [OP_FILE_RANGE_ERROR] = "Geçersiz okuma aralığı: %s",
+    [OP_FILE_APPENDED] = "Dosyaya içerik eklendi: %s",
+    [OP_FILE_DELETED] = "Dosya silindi: %s",
+    [OP_FILE_DELETE_ERROR] = "Dosya silme hatası: %s",
+    [OP_FILES_FILTERED] = "Desene göre dosyalar listelendi: %s",
+    [OP_FILTER_ERROR] = "Desene göre listeleme hatası: %s",
+    [OP_DIR_TREE_DELETED] = "Dizin içeriğiyle silindi: %s",
+    [OP_LOCK_TIMEOUT] = "Kilit zaman aşımı: %s",
+    [OP_CONTENT_SEARCHED] = "İçerik arandı: %s",
+    [OP_CONTENT_SEARCH_ERROR] = "İçerik arama hatası: %s",
+    [OP_FILE_COPIED] = "Dosya kopyalandı: %s",
+    [OP_FILE_COPY_ERROR] = "Dosya kopyalama hatası: %s",
+    [OP_FILE_MOVED] = "Dosya taşındı: %s",
+    [OP_FILE_MOVE_ERROR] = "Dosya taşıma hatası: %s",
+    [OP_DIR_COPIED] = "Dizin kopyalandı: %s",
+    [OP_DIR_COPY_ERROR] = "Dizin kopyalama hatası: %s",
+    [OP_CHECKSUM_COMPUTED] = "Sağlama toplamı hesaplandı: %s",
+    [OP_CHECKSUM_ERROR] = "Sağlama toplamı hatası: %s",
+};
+
+/**
+ * Asenkron halkadaki tek bir log kaydı
+ */
+typedef struct {
+    size_t length;
+    char data[MAX_CONTENT_LENGTH];
+} AsyncLogRecord;
+
+/**
+ * Asenkron loglama durumu: sabit boyutlu halka ve arka plan yazıcı
+ */
+typedef struct {
+    AsyncLogRecord* records;
+    int head;               // En eski kayıt
+    int count;              // Halkadaki kayıt sayısı
+    int maxBatch;
+    int flushIntervalMs;
+    int running;
+    int stopping;
+    int fd;
+    pid_t ownerPid;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t dataCond;
+    pthread_cond_t spaceCond;
+} AsyncLog;
+
+static AsyncLog asyncLog = {
+    .fd = -1,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .dataCond = PTHREAD_COND_INITIALIZER,
+    .spaceCond = PTHREAD_COND_INITIALIZER,
+};
+
+/**
+ * Log dosyası biçimini ayarlar
+ */
+void setLogFormat(LogFormat format) {
+    logFormat = format;
+}
+
+/**
+ * Geçerli log dosyası biçimini döndürür
+ */
+LogFormat getLogFormat() {
+    return logFormat;
+}
+
+/**
+ * Geçerli biçimin log dosyası yolunu döndürür
+ */
+const char* getLogFilePath() {
+    return (logFormat == LOG_FORMAT_BINARY) ? LOG_BINARY_FILE : LOG_FILE;
+}
+
+/**
+ * İşlem kodunun metin şablonunu döndürür
+ */
+const char* getLogOperationTemplate(LogOperation operation) {
+    if ((int)operation < 0 || operation >= OP_COUNT || operationTemplates[operation] == NULL) {
+        return "%s";
+    }
+    return operationTemplates[operation];
+}
+
+/**
+ * Log türünün metin karşılığını döndürür
+ */
+const char* getLogTypeName(int type) {
+    switch (type) {
+        case LOG_INFO:
+            return "INFO";
+        case LOG_ERROR:
+            return "ERROR";
+        case LOG_WARNING:
+            return "WARNING";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/**
+ * İkili log başlığının doğrulama değerini hesaplar
+ */
+uint32_t binaryLogCheck(const BinaryLogHeader* header) {
+    uint32_t check = 0x9E3779B9u;
+    
+    check ^= header->magic;
+    check = (check << 7 | check >> 25) ^ header->pathLength;
+    check = (check << 7 | check >> 25) ^ ((uint32_t)header->type << 8 | header->operation);
+    check = (check << 7 | check >> 25) ^ (uint32_t)header->timestampNs;
+    check = (check << 7 | check >> 25) ^ (uint32_t)(header->timestampNs >> 32);
+    check = (check << 7 | check >> 25) ^ header->pid;
+    
+    return check;
+}
 
 /**
  * Log dosyasının varlığını kontrol eder, yoksa oluşturur
@@ -13,7 +167,7 @@ ErrorCode initializeLogFile() {
     int fd;
     
     // Log dosyasını aç veya oluştur
-    fd = open(LOG_FILE, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    fd = open(getLogFilePath(), O_WRONLY | O_CREAT | O_APPEND, 0644);
     if (fd == -1) {
         return ERROR_UNKNOWN;
     }
@@ -23,110 +177,390 @@ ErrorCode initializeLogFile() {
 }
 
 /**
- * Log mesajı ekler
+ * Log dosyasını oturum boyunca açık tutar
  */
-ErrorCode logMessage(LogType type, const char* message) {
-    int fd;
-    char logBuffer[MAX_CONTENT_LENGTH];
-    char timeBuffer[50];
-    const char* logTypeStr;
-    
-    // Log türünü belirle
-    switch (type) {
-        case LOG_INFO:
-            logTypeStr = "INFO";
-            break;
-        case LOG_ERROR:
-            logTypeStr = "ERROR";
-            break;
-        case LOG_WARNING:
-            logTypeStr = "WARNING";
-            break;
-        default:
-            logTypeStr = "UNKNOWN";
+ErrorCode openLogSession() {
+    if (sessionLogFd != -1) {
+        return SUCCESS;
     }
     
-    // Zaman damgasını al
-    getCurrentTimeStamp(timeBuffer, sizeof(timeBuffer));
-    
-    // Log mesajını oluştur
-    string_format(logBuffer, sizeof(logBuffer), "[%s] [%s] %s\n", timeBuffer, logTypeStr, message);
-    
-    // Log dosyasını aç
-    fd = open(LOG_FILE, O_WRONLY | O_APPEND);
-    if (fd == -1) {
+    sessionLogFd = open(getLogFilePath(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (sessionLogFd == -1) {
         return ERROR_UNKNOWN;
     }
     
-    // Dosyayı kilitle
+    return SUCCESS;
+}
+
+/**
+ * Oturum log dosyasını kapatır
+ */
+void closeLogSession() {
+    if (sessionLogFd != -1) {
+        close(sessionLogFd);
+        sessionLogFd = -1;
+    }
+}
+
+/**
+ * Etkin log dosyasını kilitler. Tanımlayıcı döndürülmüş (veya silinmiş) bir
+ * dosyayı gösteriyorsa aynı numara üzerinde yeni etkin dosya açılır.
+ */
+static ErrorCode lockActiveLogFile(int fd, LogFormat format) {
+    const char* path = (format == LOG_FORMAT_BINARY) ? LOG_BINARY_FILE : LOG_FILE;
+    struct stat fdSt;
+    struct stat pathSt;
     struct flock fl;
-    fl.l_type = F_WRLCK;
+    
     fl.l_whence = SEEK_SET;
     fl.l_start = 0;
     fl.l_len = 0;
     
-    if (fcntl(fd, F_SETLKW, &fl) == -1) {
-        close(fd);
+    for (;;) {
+        fl.l_type = F_WRLCK;
+        if (fcntl(fd, F_SETLKW, &fl) == -1) {
+            return ERROR_PERMISSION_DENIED;
+        }
+        
+        if (fstat(fd, &fdSt) == 0 && stat(path, &pathSt) == 0 &&
+            fdSt.st_dev == pathSt.st_dev && fdSt.st_ino == pathSt.st_ino) {
+            return SUCCESS;
+        }
+        
+        fl.l_type = F_UNLCK;
+        fcntl(fd, F_SETLK, &fl);
+        
+        int newFd = open(path, O_RDWR | O_CREAT | O_APPEND, 0644);
+        if (newFd == -1) {
+            return ERROR_UNKNOWN;
+        }
+        if (dup2(newFd, fd) == -1) {
+            close(newFd);
+            return ERROR_UNKNOWN;
+        }
+        close(newFd);
+    }
+}
+
+/**
+ * Log satırlarını dosyayı tek bir kez kilitleyerek yazar
+ */
+static ErrorCode writeLogLines(int fd, LogFormat format, struct iovec* iov, int count) {
+    struct flock fl;
+    
+    // Önce süreç içindeki diğer yazıcıları, sonra diğer süreçleri dışla
+    pthread_mutex_lock(&logWriteLock);
+    if (lockActiveLogFile(fd, format) != SUCCESS) {
+        pthread_mutex_unlock(&logWriteLock);
         return ERROR_PERMISSION_DENIED;
     }
     
-    // Log mesajını yaz
-    if (write(fd, logBuffer, strlen(logBuffer)) == -1) {
-        // Kilidi kaldır
-        fl.l_type = F_UNLCK;
-        fcntl(fd, F_SETLK, &fl);
-        close(fd);
-        return ERROR_UNKNOWN;
+    // Log satırlarını yaz (kısmi yazmada kalan kısımdan devam et)
+    ErrorCode result = SUCCESS;
+    while (count > 0) {
+        ssize_t written = writev(fd, iov, count);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result = ERROR_UNKNOWN;
+            break;
+        }
+        while (count > 0 && (size_t)written >= iov->iov_len) {
+            written -= (ssize_t)iov->iov_len;
+            iov++;
+            count--;
+        }
+        if (count > 0) {
+            iov->iov_base = (char*)iov->iov_base + written;
+            iov->iov_len -= (size_t)written;
+        }
+    }
+    
+    // Sınır aşıldıysa kilit bırakılmadan dosyayı döndür
+    if (result == SUCCESS) {
+        rotateLogIfNeeded(fd, format);
     }
     
     // Kilidi kaldır
     fl.l_type = F_UNLCK;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = 0;
+    fl.l_len = 0;
     fcntl(fd, F_SETLK, &fl);
+    pthread_mutex_unlock(&logWriteLock);
     
-    close(fd);
-    return SUCCESS;
+    return result;
 }
 
 /**
- * Log dosyasındaki tüm kayıtları gösterir
+ * Arka plan yazıcı iş parçacığı: biriken kayıtları toplu olarak yazar
  */
-ErrorCode showLogs() {
-    int fd;
-    char buffer[MAX_CONTENT_LENGTH];
-    ssize_t bytesRead;
-    const char* header1 = "Log kayıtları:\n";
-    const char* header2 = "=========================================\n";
+static void* asyncLogFlusher(void* arg) {
+    struct iovec iov[ASYNC_LOG_MAX_BATCH];
     
-    // Log dosyasının varlığını kontrol et
-    if (!fileExists(LOG_FILE)) {
-        const char* error_msg = "Log dosyası mevcut değil.\n";
-        write(STDOUT_FILENO, error_msg, strlen(error_msg));
-        return ERROR_FILE_NOT_FOUND;
+    (void)arg;
+    pthread_mutex_lock(&asyncLog.lock);
+    for (;;) {
+        // Kayıt gelene kadar bekle
+        while (asyncLog.count == 0 && !asyncLog.stopping) {
+            pthread_cond_wait(&asyncLog.dataCond, &asyncLog.lock);
+        }
+        if (asyncLog.count == 0 && asyncLog.stopping) {
+            break;
+        }
+        
+        // Parti dolana ya da süre dolana kadar kayıtları biriktir
+        if (asyncLog.count < asyncLog.maxBatch && !asyncLog.stopping) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_sec += asyncLog.flushIntervalMs / 1000;
+            deadline.tv_nsec += (long)(asyncLog.flushIntervalMs % 1000) * 1000000L;
+            if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            while (asyncLog.count < asyncLog.maxBatch && !asyncLog.stopping) {
+                if (pthread_cond_timedwait(&asyncLog.dataCond, &asyncLog.lock, &deadline) == ETIMEDOUT) {
+                    break;
+                }
+            }
+        }
+        
+        // Yazılacak kayıtlar; üreticiler bu slotlara head ilerleyene kadar dokunmaz
+        int batch = (asyncLog.count < asyncLog.maxBatch) ? asyncLog.count : asyncLog.maxBatch;
+        for (int i = 0; i < batch; i++) {
+            AsyncLogRecord* record = &asyncLog.records[(asyncLog.head + i) % ASYNC_LOG_CAPACITY];
+            iov[i].iov_base = record->data;
+            iov[i].iov_len = record->length;
+        }
+        pthread_mutex_unlock(&asyncLog.lock);
+        
+        writeLogLines(asyncLog.fd, logFormat, iov, batch);
+        
+        pthread_mutex_lock(&asyncLog.lock);
+        asyncLog.head = (asyncLog.head + batch) % ASYNC_LOG_CAPACITY;
+        asyncLog.count -= batch;
+        pthread_cond_broadcast(&asyncLog.spaceCond);
     }
+    pthread_mutex_unlock(&asyncLog.lock);
     
-    // Log dosyasını aç
-    fd = open(LOG_FILE, O_RDONLY);
-    if (fd == -1) {
-        const char* error_msg = "Log dosyası açılamadı.\n";
-        write(STDOUT_FILENO, error_msg, strlen(error_msg));
-        return ERROR_UNKNOWN;
+    return NULL;
+}
+
+/**
+ * Asenkron loglamayı başlatır
+ */
+ErrorCode startAsyncLogging(int flushIntervalMs, int maxBatch) {
+    if (asyncLog.running) {
+        return SUCCESS;
     }
     
-    // Log dosyasını oku ve yazdır
-    write(STDOUT_FILENO, header1, strlen(header1));
-    write(STDOUT_FILENO, header2, strlen(header2));
+    if (flushIntervalMs <= 0) {
+        flushIntervalMs = ASYNC_LOG_DEFAULT_FLUSH_MS;
+    }
+    if (maxBatch <= 0 || maxBatch > ASYNC_LOG_MAX_BATCH) {
+        maxBatch = ASYNC_LOG_MAX_BATCH;
+    }
     
-    while ((bytesRead = read(fd, buffer, sizeof(buffer) - 1)) > 0) {
-        buffer[bytesRead] = '\0';
-        write(STDOUT_FILENO, buffer, bytesRead);
+    asyncLog.records = malloc(sizeof(AsyncLogRecord) * ASYNC_LOG_CAPACITY);
+    if (asyncLog.records == NULL) {
+        return ERROR_UNKNOWN;
     }
     
-    write(STDOUT_FILENO, header2, strlen(header2));
+    asyncLog.fd = open(getLogFilePath(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (asyncLog.fd == -1) {
+        free(asyncLog.records);
+        asyncLog.records = NULL;
+        return ERROR_UNKNOWN;
+    }
     
-    close(fd);
+    asyncLog.flushIntervalMs = flushIntervalMs;
+    asyncLog.maxBatch = maxBatch;
+    asyncLog.head = 0;
+    asyncLog.count = 0;
+    asyncLog.stopping = 0;
+    asyncLog.ownerPid = getpid();
     
-    // Başarı durumunu log dosyasına kaydet
-    logMessage(LOG_INFO, "Log kayıtları görüntülendi");
+    if (pthread_create(&asyncLog.thread, NULL, asyncLogFlusher, NULL) != 0) {
+        close(asyncLog.fd);
+        free(asyncLog.records);
+        asyncLog.records = NULL;
+        return ERROR_UNKNOWN;
+    }
     
+    asyncLog.running = 1;
     return SUCCESS;
-} 
\ No newline at end of file
+}
+
+/**
+ * Bekleyen kayıtları yazar ve asenkron loglamayı durdurur
+ */
+void stopAsyncLogging() {
+    // Çocuk işlemlerde yazıcı iş parçacığı yoktur
+    if (!asyncLog.running || asyncLog.ownerPid != getpid()) {
+        return;
+    }
+    
+    pthread_mutex_lock(&asyncLog.lock);
+    asyncLog.stopping = 1;
+    pthread_cond_broadcast(&asyncLog.dataCond);
+    pthread_mutex_unlock(&asyncLog.lock);
+    
+    pthread_join(asyncLog.thread, NULL);
+    
+    asyncLog.running = 0;
+    close(asyncLog.fd);
+    free(asyncLog.records);
+    asyncLog.records = NULL;
+}
+
+/**
+ * Kaydı asenkron halkaya ekler
+ * 
+ * @return 1: Kuyruğa alındı, 0: Senkron yazılmalı
+ */
+static int enqueueLogRecord(const char* line, size_t length) {
+    if (!asyncLog.running || asyncLog.ownerPid != getpid()) {
+        return 0;
+    }
+    
+    pthread_mutex_lock(&asyncLog.lock);
+    while (asyncLog.count == ASYNC_LOG_CAPACITY && !asyncLog.stopping) {
+        // Halka dolu: yazıcının yer açmasını bekle
+        pthread_cond_signal(&asyncLog.dataCond);
+        pthread_cond_wait(&asyncLog.spaceCond, &asyncLog.lock);
+    }
+    if (asyncLog.stopping) {
+        pthread_mutex_unlock(&asyncLog.lock);
+        return 0;
+    }
+    
+    AsyncLogRecord* record = &asyncLog.records[(asyncLog.head + asyncLog.count) % ASYNC_LOG_CAPACITY];
+    memcpy(record->data, line, length);
+    record->length = length;
+    asyncLog.count++;
+    
+    if (asyncLog.count >= asyncLog.maxBatch) {
+        pthread_cond_signal(&asyncLog.dataCond);
+    }
+    pthread_mutex_unlock(&asyncLog.lock);
+    
+    return 1;
+}
+
+/**
+ * Hazır kaydı etkin yola gönderir: paylaşılan halka, asenkron halka veya dosya
+ */
+static ErrorCode dispatchLogRecord(char* record, size_t length) {
+    // Süreçler arası paylaşılan halka açıksa kaydı oraya ekle
+    if (isShmLogActive() && shmLogAppend(record, length)) {
+        return SUCCESS;
+    }
+    
+    // Asenkron mod açıksa kaydı halkaya kopyala ve dön
+    if (enqueueLogRecord(record, length)) {
+        return SUCCESS;
+    }
+    
+    struct iovec iov = { record, length };
+    return appendLogRecords(logFormat, &iov, 1);
+}
+
+/**
+ * İkili log kaydı oluşturur
+ * 
+ * @return Kaydın hizalanmış toplam uzunluğu
+ */
+static size_t buildBinaryRecord(char* buffer, size_t size, LogType type, LogOperation operation, const char* path) {
+    BinaryLogHeader header;
+    struct timespec now;
+    size_t pathLength = strlen(path);
+    size_t maxPath = size - sizeof(header) - LOG_BINARY_ALIGNMENT;
+    
+    if (pathLength > maxPath) {
+        pathLength = maxPath;
+    }
+    
+    clock_gettime(CLOCK_REALTIME, &now);
+    header.magic = LOG_BINARY_MAGIC;
+    header.pathLength = (uint16_t)pathLength;
+    header.type = (uint8_t)type;
+    header.operation = (uint8_t)operation;
+    header.timestampNs = (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+    header.pid = (uint32_t)getpid();
+    header.check = binaryLogCheck(&header);
+    
+    size_t total = (sizeof(header) + pathLength + LOG_BINARY_ALIGNMENT - 1) & ~(size_t)(LOG_BINARY_ALIGNMENT - 1);
+    memcpy(buffer, &header, sizeof(header));
+    memcpy(buffer + sizeof(header), path, pathLength);
+    memset(buffer + sizeof(header) + pathLength, 0, total - sizeof(header) - pathLength);
+    
+    return total;
+}
+
+/**
+ * İşlem koduna göre log kaydı ekler
+ */
+ErrorCode logEvent(LogType type, LogOperation operation, const char* path) {
+    char record[MAX_CONTENT_LENGTH];
+    
+    if (path == NULL) {
+        path = "";
+    }
+    
+    // İkili biçimde metin üretilmez; yalnızca başlık ve yol yazılır
+    if (logFormat == LOG_FORMAT_BINARY) {
+        size_t length = buildBinaryRecord(record, sizeof(record), type, operation, path);
+        return dispatchLogRecord(record, length);
+    }
+    
+    string_format(record, sizeof(record), getLogOperationTemplate(operation), path);
+    return logMessage(type, record);
+}
+
+/**
+ * Log mesajı ekler
+ */
+ErrorCode logMessage(LogType type, const char* message) {
+    char logBuffer[MAX_CONTENT_LENGTH];
+    char timeBuffer[50];
+    
+    // İkili biçimde serbest metin mesajı olarak kaydedilir
+    if (logFormat == LOG_FORMAT_BINARY) {
+        return logEvent(type, OP_MESSAGE, message);
+    }
+    
+    // Zaman damgasını al
+    getCurrentTimeStamp(timeBuffer, sizeof(timeBuffer));
+    
+    // Log mesajını oluştur
+    int length = string_format(logBuffer, sizeof(logBuffer), "[%s] [%s] %s\n", timeBuffer, getLogTypeName(type), message);
+    
+    return dispatchLogRecord(logBuffer, (size_t)length);
+}
+
+/**
+ * Hazır log kayıtlarını biçimin log dosyasına ekler
+ */
+ErrorCode appendLogRecords(LogFormat format, struct iovec* iov, int count) {
+    int fd;
+    ErrorCode result;
+    
+    // Log dosyasını aç (oturum açıksa ve biçim uyuyorsa mevcut tanımlayıcıyı kullan)
+    if (sessionLogFd != -1 && format == logFormat) {
+        fd = sessionLogFd;
+    } else {
+        fd = open(format == LOG_FORMAT_BINARY ? LOG_BINARY_FILE : LOG_FILE, O_RDWR | O_APPEND | O_CREAT, 0644);
+        if (fd == -1) {
+            return ERROR_UNKNOWN;
+        }
+    }
+    
+    result = writeLogLines(fd, format, iov, count);
+    
+    if (fd != sessionLogFd) {
+        close(fd);
+    }
+    return result;
+}
@@ -7,6 +7,16 @@
 #define LOGGER_H
 
 #include "file_system.h"
+#include <stdint.h>
+#include <sys/uio.h>
+
+#define LOG_BINARY_FILE "log.bin"
+#define LOG_BINARY_MAGIC 0x424C5346u   // "FSLB"
+#define LOG_BINARY_ALIGNMENT 8
+
+#define ASYNC_LOG_CAPACITY 4096
+#define ASYNC_LOG_MAX_BATCH 1024
+#define ASYNC_LOG_DEFAULT_FLUSH_MS 100
 
 /**
  * Log türleri
@@ -17,6 +27,84 @@ typedef enum {
     LOG_WARNING
 } LogType;
 
+/**
+ * Log dosyası biçimleri
+ */
+typedef enum {
+    LOG_FORMAT_TEXT,    // log.txt: yazma anında biçimlendirilmiş satırlar
+    LOG_FORMAT_BINARY   // log.bin: sabit başlıklı ikili kayıtlar, metin showLogs sırasında üretilir
+} LogFormat;
+
+/**
+ * Log kaydının ait olduğu işlem; metin karşılığı yalnızca görüntülenirken üretilir
+ */
+typedef enum {
+    OP_MESSAGE = 0,         // Serbest metin (path alanı mesajın kendisidir)
+    OP_DIR_EXISTS,
+    OP_DIR_CREATE_ERROR,
+    OP_DIR_CREATED,
+    OP_DIR_NOT_FOUND,
+    OP_DIR_LISTED,
+    OP_DIR_LIST_ERROR,
+    OP_EXTENSION_LISTED,
+    OP_EXTENSION_LIST_ERROR,
+    OP_DIR_NOT_EMPTY,
+    OP_DIR_DELETED,
+    OP_DIR_DELETE_ERROR,
+    OP_FORK_ERROR,
+    OP_FILE_EXISTS,
+    OP_FILE_CREATE_ERROR,
+    OP_FILE_CREATED,
+    OP_FILE_NOT_FOUND,
+    OP_FILE_OPEN_ERROR,
+    OP_FILE_WRITE_ERROR,
+    OP_FILE_READ,
+    OP_FILE_READ_ERROR,
+    OP_FILE_RANGE_ERROR,
+    OP_FILE_APPENDED,
+    OP_FILE_DELETED,
+    OP_FILE_DELETE_ERROR,
+    OP_FILES_FILTERED,
+    OP_FILTER_ERROR,
+    OP_DIR_TREE_DELETED,
+    OP_LOCK_TIMEOUT,
+    OP_CONTENT_SEARCHED,
+    OP_CONTENT_SEARCH_ERROR,
+    OP_FILE_COPIED,
+    OP_FILE_COPY_ERROR,
+    OP_FILE_MOVED,
+    OP_FILE_MOVE_ERROR,
+    OP_DIR_COPIED,
+    OP_DIR_COPY_ERROR,
+    OP_CHECKSUM_COMPUTED,
+    OP_CHECKSUM_ERROR,
+    OP_COUNT
+} LogOperation;
+
+/**
+ * İkili log kaydı başlığı; ardından pathLength bayt yol gelir ve kayıt
+ * LOG_BINARY_ALIGNMENT katına tamamlanır
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t pathLength;
+    uint8_t type;
+    uint8_t operation;
+    uint64_t timestampNs;   // CLOCK_REALTIME, nanosaniye
+    uint32_t pid;
+    uint32_t check;         // Başlık alanlarından hesaplanan doğrulama değeri
+} BinaryLogHeader;
+
+/**
+ * showLogs filtreleri
+ */
+typedef struct {
+    long long sinceNs;      // Bu zamandan önceki kayıtlar atlanır (0: sınırsız)
+    long long untilNs;      // Bu zamandan sonraki kayıtlar atlanır (0: sınırsız)
+    int type;               // Yalnızca bu LogType (-1: hepsi)
+    int limit;              // En fazla kayıt sayısı (0: sınırsız)
+} LogQuery;
+
 /**
  * Log mesajı ekler
  * 
@@ -26,6 +114,62 @@ typedef enum {
  */
 ErrorCode logMessage(LogType type, const char* message);
 
+/**
+ * İşlem koduna göre log kaydı ekler. Metin biçiminde işlem şablonu yol ile
+ * biçimlendirilir; ikili biçimde yalnızca başlık ve yol yazılır.
+ * 
+ * @param type Log türü
+ * @param operation İşlem kodu
+ * @param path İşlemin yapıldığı yol (OP_MESSAGE için mesaj)
+ * @return Başarı durumu
+ */
+ErrorCode logEvent(LogType type, LogOperation operation, const char* path);
+
+/**
+ * Log dosyası biçimini ayarlar (varsayılan LOG_FORMAT_TEXT)
+ * 
+ * @param format Yeni biçim
+ */
+void setLogFormat(LogFormat format);
+
+/**
+ * Geçerli log dosyası biçimini döndürür
+ * 
+ * @return Log biçimi
+ */
+LogFormat getLogFormat();
+
+/**
+ * Geçerli biçimin log dosyası yolunu döndürür
+ * 
+ * @return LOG_FILE veya LOG_BINARY_FILE
+ */
+const char* getLogFilePath();
+
+/**
+ * İşlem kodunun metin şablonunu döndürür ("... : %s")
+ * 
+ * @param operation İşlem kodu
+ * @return Şablon
+ */
+const char* getLogOperationTemplate(LogOperation operation);
+
+/**
+ * Log türünün metin karşılığını döndürür
+ * 
+ * @param type Log türü
+ * @return "INFO", "ERROR", "WARNING" veya "UNKNOWN"
+ */
+const char* getLogTypeName(int type);
+
+/**
+ * İkili log başlığının doğrulama değerini hesaplar
+ * 
+ * @param header Başlık (check alanı hesaba katılmaz)
+ * @return Doğrulama değeri
+ */
+uint32_t binaryLogCheck(const BinaryLogHeader* header);
+
 /**
  * Log dosyasındaki tüm kayıtları gösterir
  * 
@@ -33,6 +177,45 @@ ErrorCode logMessage(LogType type, const char* message);
  */
 ErrorCode showLogs();
 
+/**
+ * Filtreye uyan log kayıtlarını gösterir. İkili logda --since/--until
+ * zaman damgaları üzerinde ikili arama ile bulunur, dosyanın tamamı taranmaz.
+ * 
+ * @param query Filtreler (NULL: tüm kayıtlar)
+ * @return Başarı durumu
+ */
+ErrorCode showLogsQuery(const LogQuery* query);
+
+/**
+ * Filtreye uyan log kayıtlarını metin olarak parça parça iletir
+ * 
+ * @param query Filtreler (NULL: tüm kayıtlar)
+ * @param callback Her parça için çağrılacak fonksiyon
+ * @param userData Geri çağırma fonksiyonuna iletilecek veri
+ * @return Başarı durumu
+ */
+ErrorCode queryLogs(const LogQuery* query, DataChunkCallback callback, void* userData);
+
+/**
+ * Log verisindeki ilk ve son kaydın zaman damgasını bulur
+ * 
+ * @param format Verinin biçimi
+ * @param data Log verisi
+ * @param size Veri uzunluğu
+ * @param firstNs İlk kaydın zamanı (bulunamazsa 0)
+ * @param lastNs Son kaydın zamanı (metinde saniyenin sonu; bulunamazsa LLONG_MAX)
+ */
+void getLogTimeRange(LogFormat format, const char* data, size_t size, long long* firstNs, long long* lastNs);
+
+/**
+ * Log kayıtlarını parça parça geri çağırma fonksiyonuna iletir
+ * 
+ * @param callback Her parça için çağrılacak fonksiyon
+ * @param userData Geri çağırma fonksiyonuna iletilecek veri
+ * @return Başarı durumu
+ */
+ErrorCode readLogs(DataChunkCallback callback, void* userData);
+
 /**
  * Log dosyasının varlığını kontrol eder, yoksa oluşturur
  * 
@@ -40,4 +223,45 @@ ErrorCode showLogs();
  */
 ErrorCode initializeLogFile();
 
+/**
+ * Log dosyasını tek seferlik açar ve sonraki logMessage çağrılarının
+ * aynı dosya tanımlayıcısını kullanmasını sağlar (toplu çalıştırma için)
+ * 
+ * @return Başarı durumu
+ */
+ErrorCode openLogSession();
+
+/**
+ * openLogSession ile açılan log dosyasını kapatır
+ */
+void closeLogSession();
+
+/**
+ * Hazır log kayıtlarını biçimin log dosyasına tek kilit altında tek writev
+ * ile ekler (oturum açıksa ve biçim uyuyorsa oturum tanımlayıcısı kullanılır)
+ * 
+ * @param format Kayıtların biçimi
+ * @param iov Kayıtlar
+ * @param count Kayıt sayısı
+ * @return Başarı durumu
+ */
+ErrorCode appendLogRecords(LogFormat format, struct iovec* iov, int count);
+
+/**
+ * Asenkron loglamayı başlatır. Sonraki logMessage çağrıları kaydı bellekteki
+ * halkaya kopyalayıp döner; arka plan iş parçacığı kayıtları tek kilit
+ * altında tek bir writev ile toplu yazar. Başlatılmazsa veya başlatılamazsa
+ * loglama senkron devam eder.
+ * 
+ * @param flushIntervalMs Kayıtların en fazla bekleyeceği süre (ms, <= 0 ise varsayılan)
+ * @param maxBatch Tek yazmadaki en fazla kayıt sayısı (<= 0 ise ASYNC_LOG_MAX_BATCH)
+ * @return Başarı durumu
+ */
+ErrorCode startAsyncLogging(int flushIntervalMs, int maxBatch);
+
+/**
+ * Halkada bekleyen tüm kayıtları yazar ve senkron loglamaya döner
+ */
+void stopAsyncLogging();
+
 #endif /* LOGGER_H */ 
\ No newline at end of file
@@ -8,6 +8,171 @@
 #include "directory_operations.h"
 #include "logger.h"
 #include "utils.h"
+#include "executor.h"
+#include "batch.h"
+#include "server.h"
+#include "shm_log.h"
+#include "log_segments.h"
+#include "work_pool.h"
+#include "extension_index.h"
+
+// Asenkron loglama ayarları (--log-async, --log-flush-ms, --log-batch)
+static int asyncLogging = 0;
+static int logFlushIntervalMs = 0;
+static int logMaxBatch = 0;
+
+// Log döndürme sınırları (--log-rotate-kb, --log-rotate-age)
+static int logRotateKb = 0;
+static int logRotateAgeSeconds = 0;
+
+// Paralel işlemlerin iş parçacığı sayısı (--threads)
+static int workerThreads = 0;
+
+// Komut sonunda istatistik yazdırma (--stats)
+static int printStats = 0;
+
+// Süreçler arası paylaşılan log halkası (--log-shm)
+static int sharedLogging = 0;
+
+/**
+ * "--name=N" biçimindeki seçeneğin sayısal değerini okur
+ * 
+ * @return 1: Seçenek eşleşti ve değer geçerli, 0: Eşleşmedi, -1: Geçersiz değer
+ */
+static int parseIntOption(const char* arg, const char* name, int* value) {
+    size_t nameLen = strlen(name);
+    char* end;
+    
+    if (strncmp(arg, name, nameLen) != 0 || arg[nameLen] != '=') {
+        return 0;
+    }
+    
+    long parsed = strtol(arg + nameLen + 1, &end, 10);
+    if (end == arg + nameLen + 1 || *end != '\0' || parsed <= 0 || parsed > 1000000) {
+        return -1;
+    }
+    
+    *value = (int)parsed;
+    return 1;
+}
+
+/**
+ * "--lock-timeout=N" veya "--lock-timeout=Nms" seçeneğini okur; 0 tek denemedir
+ * 
+ * @return 1: Seçenek eşleşti ve değer geçerli, 0: Eşleşmedi, -1: Geçersiz değer
+ */
+static int parseLockTimeoutOption(const char* arg) {
+    const char* name = "--lock-timeout=";
+    size_t nameLen = strlen(name);
+    char* end;
+    
+    if (strncmp(arg, name, nameLen) != 0) {
+        return 0;
+    }
+    
+    long parsed = strtol(arg + nameLen, &end, 10);
+    if (end == arg + nameLen || (*end != '\0' && strcmp(end, "ms") != 0) || parsed < 0 || parsed > 1000000) {
+        return -1;
+    }
+    
+    setLockTimeout((int)parsed);
+    return 1;
+}
+
+/**
+ * Komut adından önce verilen genel seçenekleri uygular
+ * 
+ * @return İşlenen seçenek sayısı, bilinmeyen seçenekte -1
+ */
+static int applyGlobalOptions(int argc, char* argv[]) {
+    int i;
+    int matched;
+    
+    for (i = 1; i < argc && strncmp(argv[i], "--", 2) == 0; i++) {
+        if (strcmp(argv[i], "--isolate") == 0) {
+            // İşlemleri ayrı çocuk işlemlerde çalıştır
+            setIsolationMode(1);
+        } else if (strcmp(argv[i], "--index") == 0) {
+            // listFilesByExtension kalıcı uzantı indeksini kullanır
+            setExtensionIndexEnabled(1);
+        } else if (strcmp(argv[i], "--lock-mode=exclusive") == 0) {
+            setLockMode(LOCK_MODE_EXCLUSIVE);
+        } else if (strcmp(argv[i], "--lock-mode=shared") == 0) {
+            // Okuyanlar paylaşımlı, ekleyenler yalnızca dosya sonunu kilitler
+            setLockMode(LOCK_MODE_SHARED);
+        } else if (strcmp(argv[i], "--batch-backend=sync") == 0) {
+            setBatchBackend(BATCH_BACKEND_SYNC);
+        } else if (strcmp(argv[i], "--batch-backend=uring") == 0) {
+            // Toplu çalıştırmada bağımsız komutlar io_uring ile birlikte gönderilir
+            setBatchBackend(BATCH_BACKEND_URING);
+        } else if ((matched = parseLockTimeoutOption(argv[i])) != 0) {
+            if (matched < 0) {
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            printStats = 1;
+        } else if (strcmp(argv[i], "--log-shm") == 0) {
+            sharedLogging = 1;
+        } else if (strcmp(argv[i], "--log-format=text") == 0) {
+            setLogFormat(LOG_FORMAT_TEXT);
+        } else if (strcmp(argv[i], "--log-format=binary") == 0) {
+            // Kayıtlar ikili olarak yazılır, metne yalnızca showLogs'ta çevrilir
+            setLogFormat(LOG_FORMAT_BINARY);
+        } else if (strcmp(argv[i], "--log-async") == 0) {
+            asyncLogging = 1;
+        } else if ((matched = parseIntOption(argv[i], "--log-flush-ms", &logFlushIntervalMs)) != 0 ||
+                   (matched = parseIntOption(argv[i], "--log-batch", &logMaxBatch)) != 0) {
+            if (matched < 0) {
+                return -1;
+            }
+            asyncLogging = 1;
+        } else if ((matched = parseIntOption(argv[i], "--threads", &workerThreads)) != 0) {
+            if (matched < 0) {
+                return -1;
+            }
+            setDefaultPoolSize(workerThreads);
+        } else if ((matched = parseIntOption(argv[i], "--log-rotate-kb", &logRotateKb)) != 0 ||
+                   (matched = parseIntOption(argv[i], "--log-rotate-age", &logRotateAgeSeconds)) != 0) {
+            if (matched < 0) {
+                return -1;
+            }
+            setLogRotation((long long)logRotateKb * 1024, logRotateAgeSeconds);
+        } else if (strcmp(argv[i], "--help") == 0) {
+            break;
+        } else {
+            return -1;
+        }
+    }
+    
+    return i - 1;
+}
+
+/**
+ * İşlem istatistiklerini standart hataya yazar
+ */
+static void writeStats() {
+    char line[MAX_CONTENT_LENGTH];
+    int len = string_format(line, sizeof(line), "İstatistik: listeleme stat çağrısı: %llu\n", getListingStatCount());
+    write(STDERR_FILENO, line, len);
+    
+    if (isExtensionIndexEnabled()) {
+        unsigned long hits, rebuilds;
+        getExtensionIndexStats(&hits, &rebuilds);
+        len = string_format(line, sizeof(line), "İstatistik: uzantı indeksi isabet: %lu, yeniden oluşturma: %lu\n",
+                            hits, rebuilds);
+        write(STDERR_FILENO, line, len);
+    }
+    
+    LockStats lockStats;
+    getLockStats(&lockStats);
+    if (lockStats.acquisitions > 0 || lockStats.timeouts > 0) {
+        len = string_format(line, sizeof(line),
+                            "İstatistik: kilit: %lu alındı, %lu zaman aşımı, toplam bekleme %llu us, en uzun %llu us\n",
+                            lockStats.acquisitions, lockStats.timeouts,
+                            lockStats.totalWaitNs / 1000, lockStats.maxWaitNs / 1000);
+        write(STDERR_FILENO, line, len);
+    }
+}
 
 /**
  * Ana program fonksiyonu
@@ -18,14 +183,34 @@ int main(int argc, char* argv[]) {
     const char* unknownCmdMsg = "Bilinmeyen komut!\n";
     char errorMsg[MAX_CONTENT_LENGTH];
 
-    // Log dosyasını başlat
+    // Genel seçenekleri uygula ve komutun başına kaydır
+    int optionCount = applyGlobalOptions(argc, argv);
+    if (optionCount < 0) {
+        string_format(errorMsg, sizeof(errorMsg), "Komut işlenemedi: %s\n", getErrorMessage(ERROR_INVALID_ARGUMENT));
+        write(STDERR_FILENO, errorMsg, strlen(errorMsg));
+        return EXIT_FAILURE;
+    }
+    argc -= optionCount;
+    argv += optionCount;
+
+    // Log dosyasını seçilen biçimde başlat
     result = initializeLogFile();
     if (result != SUCCESS) {
         string_format(errorMsg, sizeof(errorMsg), "Log dosyası başlatılamadı: %s\n", getErrorMessage(result));
         write(STDERR_FILENO, errorMsg, strlen(errorMsg));
         return EXIT_FAILURE;
     }
-
+    
+    // Asenkron loglama; başlatılamazsa senkron loglama ile devam edilir
+    if (asyncLogging && startAsyncLogging(logFlushIntervalMs, logMaxBatch) == SUCCESS) {
+        atexit(stopAsyncLogging);
+    }
+    
+    // Paylaşılan log halkası; sonlanırken halkada kalanlar dosyaya aktarılır
+    if (sharedLogging && openShmLog() == SUCCESS) {
+        atexit(closeShmLog);
+    }
+    
     // Eğer argüman yoksa yardım mesajını göster
     if (argc < 2) {
         showHelp();
@@ -42,32 +227,21 @@ int main(int argc, char* argv[]) {
 
     // Komuta göre işlemleri gerçekleştir
     switch (cmd.type) {
-        case CMD_CREATE_DIR:
-            result = createDir(cmd.arg1);
+        case CMD_BATCH:
+            result = runBatch(cmd.arg1);
             break;
-        case CMD_CREATE_FILE:
-            result = createFile(cmd.arg1);
+        case CMD_APPEND_BATCH:
+            result = runAppendBatch(cmd.arg1);
             break;
-        case CMD_LIST_DIR:
-            result = listDir(cmd.arg1);
+        case CMD_SERVE:
+            result = runServer(cmd.arg1);
             break;
-        case CMD_LIST_FILES_BY_EXTENSION:
-            result = listFilesByExtension(cmd.arg1, cmd.arg2);
+        case CMD_LOGD:
+            result = runLogDaemon(atoi(cmd.arg1));
             break;
-        case CMD_READ_FILE:
-            result = readFile(cmd.arg1);
-            break;
-        case CMD_APPEND_TO_FILE:
-            result = appendToFile(cmd.arg1, cmd.arg2);
-            break;
-        case CMD_DELETE_FILE:
-            result = deleteFile(cmd.arg1);
-            break;
-        case CMD_DELETE_DIR:
-            result = deleteDir(cmd.arg1);
-            break;
-        case CMD_SHOW_LOGS:
-            result = showLogs();
+        case CMD_CLIENT:
+            // client "socketPath" <komut> ... : komut ve argümanları olduğu gibi iletilir
+            result = runClient(cmd.arg1, argc - 3, argv + 3);
             break;
         case CMD_HELP:
             showHelp();
@@ -77,9 +251,12 @@ int main(int argc, char* argv[]) {
             showHelp();
             return EXIT_FAILURE;
         default:
-            write(STDERR_FILENO, unknownCmdMsg, strlen(unknownCmdMsg));
-            showHelp();
-            return EXIT_FAILURE;
+            result = executeCommand(&cmd);
+            break;
+    }
+
+    if (printStats) {
+        writeStats();
     }
 
     // İşlem sonucunu kontrol et
@@ -0,0 +1,153 @@
+/**
+ * protocol.c
+ * İkili çerçeve protokolü fonksiyonlarının implementasyonları
+ */
+
+#include "protocol.h"
+#include <poll.h>
+#include <sys/socket.h>
+
+/**
+ * Argümanları istek çerçevesine kodlar
+ */
+int encodeRequest(char* buffer, size_t size, int argc, char* argv[]) {
+    size_t pos = PROTOCOL_LENGTH_SIZE;
+    uint16_t count = (uint16_t)argc;
+    
+    if (argc <= 0 || argc > PROTOCOL_MAX_ARGS || size < pos + sizeof(count)) {
+        return -1;
+    }
+    
+    memcpy(buffer + pos, &count, sizeof(count));
+    pos += sizeof(count);
+    
+    for (int i = 0; i < argc; i++) {
+        size_t argLen = strlen(argv[i]) + 1;  // '\0' dahil
+        uint16_t encodedLen = (uint16_t)argLen;
+        
+        if (argLen > UINT16_MAX || pos + sizeof(encodedLen) + argLen > size) {
+            return -1;
+        }
+        
+        memcpy(buffer + pos, &encodedLen, sizeof(encodedLen));
+        pos += sizeof(encodedLen);
+        memcpy(buffer + pos, argv[i], argLen);
+        pos += argLen;
+    }
+    
+    uint32_t payloadLen = (uint32_t)(pos - PROTOCOL_LENGTH_SIZE);
+    memcpy(buffer, &payloadLen, sizeof(payloadLen));
+    
+    return (int)pos;
+}
+
+/**
+ * İstek yükünü çözer
+ */
+int decodeRequest(char* payload, size_t length, char* argv[], int maxArgs) {
+    size_t pos = 0;
+    uint16_t count;
+    
+    if (length < sizeof(count)) {
+        return -1;
+    }
+    
+    memcpy(&count, payload, sizeof(count));
+    pos += sizeof(count);
+    
+    if (count == 0 || count > maxArgs) {
+        return -1;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        uint16_t argLen;
+        
+        if (pos + sizeof(argLen) > length) {
+            return -1;
+        }
+        memcpy(&argLen, payload + pos, sizeof(argLen));
+        pos += sizeof(argLen);
+        
+        // Argüman '\0' ile bitmeli
+        if (argLen == 0 || pos + argLen > length || payload[pos + argLen - 1] != '\0') {
+            return -1;
+        }
+        
+        argv[i] = payload + pos;
+        pos += argLen;
+    }
+    
+    return count;
+}
+
+/**
+ * Yanıt başlığını kodlar
+ */
+void encodeResponseHeader(char* header, ErrorCode status, uint32_t length) {
+    int32_t code = (int32_t)status;
+    
+    memcpy(header, &code, sizeof(code));
+    memcpy(header + sizeof(code), &length, sizeof(length));
+}
+
+/**
+ * Yanıt başlığını çözer
+ */
+void decodeResponseHeader(const char* header, ErrorCode* status, uint32_t* length) {
+    int32_t code;
+    
+    memcpy(&code, header, sizeof(code));
+    memcpy(length, header + sizeof(code), sizeof(*length));
+    *status = (ErrorCode)code;
+}
+
+/**
+ * Verinin tamamını gönderir
+ */
+int sendAll(int fd, const void* data, size_t length) {
+    const char* p = data;
+    
+    while (length > 0) {
+        ssize_t sent = send(fd, p, length, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                // Bloklamayan soket: yazılabilir olana kadar bekle
+                struct pollfd pfd = { .fd = fd, .events = POLLOUT };
+                poll(&pfd, 1, -1);
+                continue;
+            }
+            return -1;
+        }
+        p += sent;
+        length -= (size_t)sent;
+    }
+    
+    return 0;
+}
+
+/**
+ * Tam olarak length bayt okur
+ */
+int recvAll(int fd, void* data, size_t length) {
+    char* p = data;
+    
+    while (length > 0) {
+        ssize_t received = recv(fd, p, length, 0);
+        if (received < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (received == 0) {
+            return -1;
+        }
+        p += received;
+        length -= (size_t)received;
+    }
+    
+    return 0;
+}
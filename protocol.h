@@ -0,0 +1,82 @@
+/**
+ * protocol.h
+ * Sunucu ve istemci arasındaki ikili çerçeve protokolü tanımlamaları
+ *
+ * İstek çerçevesi:  [uint32 yük uzunluğu][uint16 argc][argc x (uint16 uzunluk, bayt dizisi + '\0')]
+ * Yanıt çerçevesi:  [int32 ErrorCode][uint32 çıktı uzunluğu][çıktı baytları]
+ *
+ * Soket yerel olduğu için sayılar makinenin bayt sırasıyla gönderilir.
+ */
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include "file_system.h"
+#include <stdint.h>
+
+#define PROTOCOL_MAX_ARGS 16
+#define PROTOCOL_MAX_FRAME 65536
+#define PROTOCOL_LENGTH_SIZE 4
+#define PROTOCOL_RESPONSE_HEADER_SIZE 8
+
+/**
+ * Argümanları istek çerçevesine kodlar
+ * 
+ * @param buffer Hedef buffer (uzunluk alanı dahil)
+ * @param size Buffer boyutu
+ * @param argc Argüman sayısı
+ * @param argv Argüman dizisi (argv[0] komut adıdır)
+ * @return Çerçevenin toplam uzunluğu, sığmazsa -1
+ */
+int encodeRequest(char* buffer, size_t size, int argc, char* argv[]);
+
+/**
+ * İstek yükünü çözer; argv elemanları yükün içini gösterir
+ * 
+ * @param payload Uzunluk alanı hariç yük
+ * @param length Yük uzunluğu
+ * @param argv Doldurulacak argüman dizisi
+ * @param maxArgs argv kapasitesi
+ * @return Argüman sayısı, geçersiz çerçevede -1
+ */
+int decodeRequest(char* payload, size_t length, char* argv[], int maxArgs);
+
+/**
+ * Yanıt başlığını kodlar
+ * 
+ * @param header En az PROTOCOL_RESPONSE_HEADER_SIZE baytlık buffer
+ * @param status İşlem sonucu
+ * @param length Ardından gelecek çıktı uzunluğu
+ */
+void encodeResponseHeader(char* header, ErrorCode status, uint32_t length);
+
+/**
+ * Yanıt başlığını çözer
+ * 
+ * @param header PROTOCOL_RESPONSE_HEADER_SIZE baytlık başlık
+ * @param status İşlem sonucu
+ * @param length Çıktı uzunluğu
+ */
+void decodeResponseHeader(const char* header, ErrorCode* status, uint32_t* length);
+
+/**
+ * Verinin tamamını gönderir (kısmi yazmaları ve EAGAIN durumunu yönetir)
+ * 
+ * @param fd Soket
+ * @param data Gönderilecek veri
+ * @param length Veri uzunluğu
+ * @return 0: Başarılı, -1: Hata
+ */
+int sendAll(int fd, const void* data, size_t length);
+
+/**
+ * Tam olarak length bayt okur
+ * 
+ * @param fd Soket
+ * @param data Hedef buffer
+ * @param length Okunacak bayt sayısı
+ * @return 0: Başarılı, -1: Hata veya bağlantı kapandı
+ */
+int recvAll(int fd, void* data, size_t length);
+
+#endif /* PROTOCOL_H */
@@ -0,0 +1,541 @@
+/**
+ * server.c
+ * Unix soketi sunucusu ve istemcisinin implementasyonları
+ */
+
+#define _GNU_SOURCE
+#include "server.h"
+#include "protocol.h"
+#include "executor.h"
+#include "logger.h"
+#include "utils.h"
+#include <pthread.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+
+/**
+ * İstemci bağlantısı; aynı anda ya olay döngüsüne ya da tek bir işçiye aittir
+ */
+typedef struct Connection {
+    int fd;
+    int peerClosed;
+    size_t have;
+    struct Connection* next;
+    char buffer[PROTOCOL_LENGTH_SIZE + PROTOCOL_MAX_FRAME];
+} Connection;
+
+/**
+ * Sunucu durumu
+ */
+typedef struct {
+    int epollFd;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    Connection* head;
+    Connection* tail;
+    int stopping;
+} Server;
+
+static Server server = {
+    .epollFd = -1,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .cond = PTHREAD_COND_INITIALIZER,
+};
+
+/**
+ * Buffer'da tam bir istek çerçevesi olup olmadığını kontrol eder
+ * 
+ * @return 1: Tam, 0: Eksik, -1: Geçersiz çerçeve
+ */
+static int frameComplete(const Connection* conn) {
+    uint32_t length;
+    
+    if (conn->have < PROTOCOL_LENGTH_SIZE) {
+        return 0;
+    }
+    
+    memcpy(&length, conn->buffer, sizeof(length));
+    if (length == 0 || length > PROTOCOL_MAX_FRAME) {
+        return -1;
+    }
+    
+    return conn->have >= PROTOCOL_LENGTH_SIZE + length;
+}
+
+/**
+ * Bağlantıyı kapatır ve belleğini serbest bırakır
+ */
+static void closeConnection(Connection* conn) {
+    close(conn->fd);
+    free(conn);
+}
+
+/**
+ * Bağlantıyı bir sonraki istek için olay döngüsüne geri verir
+ */
+static void rearmConnection(Connection* conn) {
+    struct epoll_event ev;
+    
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.ptr = conn;
+    if (epoll_ctl(server.epollFd, EPOLL_CTL_MOD, conn->fd, &ev) == -1) {
+        closeConnection(conn);
+    }
+}
+
+/**
+ * Tamamlanan isteği işçi kuyruğuna ekler
+ */
+static void enqueueConnection(Connection* conn) {
+    pthread_mutex_lock(&server.lock);
+    conn->next = NULL;
+    if (server.tail != NULL) {
+        server.tail->next = conn;
+    } else {
+        server.head = conn;
+    }
+    server.tail = conn;
+    pthread_cond_signal(&server.cond);
+    pthread_mutex_unlock(&server.lock);
+}
+
+/**
+ * Buffer'daki ilk isteği çalıştırır ve yanıtı gönderir
+ * 
+ * @param conn Bağlantı
+ * @param outputFd Komut çıktısının toplandığı bellek dosyası
+ * @return 0: Başarılı, -1: Yanıt gönderilemedi
+ */
+static int handleRequest(Connection* conn, int outputFd) {
+    char* args[PROTOCOL_MAX_ARGS + 1];
+    char header[PROTOCOL_RESPONSE_HEADER_SIZE];
+    Command cmd;
+    ErrorCode result;
+    uint32_t length;
+    int argc;
+    
+    memcpy(&length, conn->buffer, sizeof(length));
+    
+    // Komut çıktısını bellek dosyasına yönlendir
+    ftruncate(outputFd, 0);
+    lseek(outputFd, 0, SEEK_SET);
+    
+    argc = decodeRequest(conn->buffer + PROTOCOL_LENGTH_SIZE, length, args + 1, PROTOCOL_MAX_ARGS);
+    if (argc < 0) {
+        result = ERROR_INVALID_ARGUMENT;
+    } else {
+        args[0] = "file_system";
+        result = parseCommand(argc + 1, args, &cmd);
+        if (result == SUCCESS && (cmd.flags & (CMD_FLAG_STDIN | CMD_FLAG_FOLLOW))) {
+            // Sunucunun standart girdisi istemcininki değildir; çıktı komut
+            // bitince gönderildiğinden bitmeyen takip komutu çalıştırılamaz
+            result = ERROR_INVALID_ARGUMENT;
+        } else if (result == SUCCESS) {
+            setOutputFd(outputFd);
+            result = executeCommand(&cmd);
+            setOutputFd(STDOUT_FILENO);
+        }
+    }
+    
+    // Yanıt uzunluğu 32 bitlik alana sığmalı; sığmayan çıktı kesilerek
+    // gönderilmez, istemciye hata döner
+    off_t outputSize = lseek(outputFd, 0, SEEK_CUR);
+    if (outputSize < 0 || outputSize > UINT32_MAX) {
+        if (outputSize > UINT32_MAX) {
+            char logMsg[100];
+            string_format(logMsg, sizeof(logMsg), "Yanıt çok büyük (%lld bayt), gönderilmedi", (long long)outputSize);
+            logMessage(LOG_ERROR, logMsg);
+        }
+        outputSize = 0;
+        result = ERROR_UNKNOWN;
+    }
+    
+    // İşlenen çerçeveyi buffer'dan çıkar (ardışık gönderilmiş istekler korunur)
+    size_t consumed = PROTOCOL_LENGTH_SIZE + length;
+    memmove(conn->buffer, conn->buffer + consumed, conn->have - consumed);
+    conn->have -= consumed;
+    
+    // Yanıt başlığı ve ardından çıktı (çekirdek içinde kopyalanarak)
+    encodeResponseHeader(header, result, (uint32_t)outputSize);
+    if (sendAll(conn->fd, header, sizeof(header)) == -1) {
+        return -1;
+    }
+    
+    off_t offset = 0;
+    while (offset < outputSize) {
+        ssize_t sent = sendfile(conn->fd, outputFd, &offset, (size_t)(outputSize - offset));
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN) {
+                struct pollfd pfd = { .fd = conn->fd, .events = POLLOUT };
+                poll(&pfd, 1, -1);
+                continue;
+            }
+            return -1;
+        }
+        if (sent == 0) {
+            return -1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * İşçi iş parçacığı: kuyruktan bağlantı alır ve isteklerini çalıştırır
+ */
+static void* workerMain(void* arg) {
+    (void)arg;
+    
+    int outputFd = memfd_create("file_system_output", MFD_CLOEXEC);
+    if (outputFd == -1) {
+        return NULL;
+    }
+    
+    for (;;) {
+        pthread_mutex_lock(&server.lock);
+        while (server.head == NULL && !server.stopping) {
+            pthread_cond_wait(&server.cond, &server.lock);
+        }
+        if (server.stopping) {
+            // Kapanışta kuyrukta bekleyen istekler çalıştırılmadan kapatılır
+            while (server.head != NULL) {
+                Connection* pending = server.head;
+                server.head = pending->next;
+                closeConnection(pending);
+            }
+            server.tail = NULL;
+            pthread_mutex_unlock(&server.lock);
+            break;
+        }
+        Connection* conn = server.head;
+        server.head = conn->next;
+        if (server.head == NULL) {
+            server.tail = NULL;
+        }
+        pthread_mutex_unlock(&server.lock);
+        
+        // Kapanış başladıysa ardışık gönderilmiş sonraki istekler çalıştırılmaz
+        int failed = 0;
+        while (frameComplete(conn) == 1 && !__atomic_load_n(&server.stopping, __ATOMIC_RELAXED)) {
+            if (handleRequest(conn, outputFd) == -1) {
+                failed = 1;
+                break;
+            }
+        }
+        
+        if (failed || conn->peerClosed || frameComplete(conn) == -1 ||
+            __atomic_load_n(&server.stopping, __ATOMIC_RELAXED)) {
+            closeConnection(conn);
+        } else {
+            rearmConnection(conn);
+        }
+    }
+    
+    close(outputFd);
+    return NULL;
+}
+
+/**
+ * Okunabilir bağlantıdaki veriyi buffer'a alır
+ */
+static void readConnection(Connection* conn) {
+    for (;;) {
+        if (conn->have == sizeof(conn->buffer)) {
+            break;
+        }
+        
+        ssize_t bytesRead = read(conn->fd, conn->buffer + conn->have, sizeof(conn->buffer) - conn->have);
+        if (bytesRead > 0) {
+            conn->have += (size_t)bytesRead;
+            continue;
+        }
+        if (bytesRead == 0) {
+            conn->peerClosed = 1;
+            break;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        }
+        closeConnection(conn);
+        return;
+    }
+    
+    int complete = frameComplete(conn);
+    if (complete == 1) {
+        enqueueConnection(conn);
+    } else if (complete == -1 || conn->peerClosed) {
+        closeConnection(conn);
+    } else {
+        rearmConnection(conn);
+    }
+}
+
+/**
+ * Bekleyen bağlantıları kabul eder
+ */
+static void acceptConnections(int listenFd) {
+    for (;;) {
+        int fd = accept4(listenFd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        
+        Connection* conn = malloc(sizeof(Connection));
+        if (conn == NULL) {
+            close(fd);
+            continue;
+        }
+        conn->fd = fd;
+        conn->peerClosed = 0;
+        conn->have = 0;
+        conn->next = NULL;
+        
+        struct epoll_event ev;
+        ev.events = EPOLLIN | EPOLLONESHOT;
+        ev.data.ptr = conn;
+        if (epoll_ctl(server.epollFd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+            closeConnection(conn);
+        }
+    }
+}
+
+/**
+ * Dinleme soketini oluşturur
+ * 
+ * @return Soket tanımlayıcısı, hata durumunda -1 (errno korunur)
+ */
+static int createListenSocket(const char* socketPath, ErrorCode* error) {
+    struct sockaddr_un addr;
+    int fd;
+    
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(socketPath) >= sizeof(addr.sun_path)) {
+        *error = ERROR_INVALID_ARGUMENT;
+        return -1;
+    }
+    strcpy(addr.sun_path, socketPath);
+    
+    // Yol üzerinde çalışan bir sunucu varsa devralma, eski soket dosyasını temizle
+    if (fileExists(socketPath)) {
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd != -1 && connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+            close(fd);
+            *error = ERROR_FILE_EXISTS;
+            return -1;
+        }
+        if (fd != -1) {
+            close(fd);
+        }
+        unlink(socketPath);
+    }
+    
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd == -1) {
+        *error = ERROR_UNKNOWN;
+        return -1;
+    }
+    
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) == -1 ||
+        listen(fd, SERVER_LISTEN_BACKLOG) == -1) {
+        *error = (errno == EACCES) ? ERROR_PERMISSION_DENIED : ERROR_UNKNOWN;
+        close(fd);
+        return -1;
+    }
+    
+    return fd;
+}
+
+/**
+ * Unix soketini dinleyen sunucuyu başlatır
+ */
+ErrorCode runServer(const char* socketPath) {
+    char logMsg[MAX_PATH_LENGTH + 50];
+    pthread_t workers[SERVER_MAX_WORKERS];
+    int workerCount;
+    int listenFd;
+    int signalFd;
+    sigset_t signals;
+    ErrorCode result = SUCCESS;
+    
+    // Kapanmış istemciye yazarken işlem sonlanmasın
+    signal(SIGPIPE, SIG_IGN);
+    
+    // Sonlandırma sinyallerini olay döngüsünde işle (işçiler de bu maskeyi devralır)
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+    signalFd = signalfd(-1, &signals, SFD_CLOEXEC);
+    if (signalFd == -1) {
+        return ERROR_UNKNOWN;
+    }
+    
+    listenFd = createListenSocket(socketPath, &result);
+    if (listenFd == -1) {
+        string_format(logMsg, sizeof(logMsg), "Sunucu soketi oluşturulamadı: %s", socketPath);
+        logMessage(LOG_ERROR, logMsg);
+        close(signalFd);
+        return result;
+    }
+    
+    server.epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (server.epollFd == -1) {
+        close(listenFd);
+        close(signalFd);
+        return ERROR_UNKNOWN;
+    }
+    
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = &listenFd;
+    epoll_ctl(server.epollFd, EPOLL_CTL_ADD, listenFd, &ev);
+    ev.data.ptr = &signalFd;
+    epoll_ctl(server.epollFd, EPOLL_CTL_ADD, signalFd, &ev);
+    
+    openLogSession();
+    
+    // İşçi havuzunu başlat
+    workerCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (workerCount < 2) {
+        workerCount = 2;
+    }
+    if (workerCount > SERVER_MAX_WORKERS) {
+        workerCount = SERVER_MAX_WORKERS;
+    }
+    server.stopping = 0;
+    for (int i = 0; i < workerCount; i++) {
+        if (pthread_create(&workers[i], NULL, workerMain, NULL) != 0) {
+            workerCount = i;
+            break;
+        }
+    }
+    
+    string_format(logMsg, sizeof(logMsg), "Sunucu başlatıldı: %s", socketPath);
+    logMessage(LOG_INFO, logMsg);
+    
+    // Olay döngüsü
+    int running = 1;
+    while (running) {
+        struct epoll_event events[SERVER_MAX_EVENTS];
+        int count = epoll_wait(server.epollFd, events, SERVER_MAX_EVENTS, -1);
+        
+        if (count == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result = ERROR_UNKNOWN;
+            break;
+        }
+        
+        for (int i = 0; i < count; i++) {
+            if (events[i].data.ptr == &listenFd) {
+                acceptConnections(listenFd);
+            } else if (events[i].data.ptr == &signalFd) {
+                running = 0;
+            } else {
+                readConnection(events[i].data.ptr);
+            }
+        }
+    }
+    
+    // İşçileri durdur; kuyrukta kalan bağlantılar istekleri çalıştırılmadan
+    // kapatılır, çalışmakta olan istek tamamlanır
+    pthread_mutex_lock(&server.lock);
+    __atomic_store_n(&server.stopping, 1, __ATOMIC_RELAXED);
+    pthread_cond_broadcast(&server.cond);
+    pthread_mutex_unlock(&server.lock);
+    
+    for (int i = 0; i < workerCount; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    
+    close(listenFd);
+    close(signalFd);
+    close(server.epollFd);
+    server.epollFd = -1;
+    unlink(socketPath);
+    
+    string_format(logMsg, sizeof(logMsg), "Sunucu durduruldu: %s", socketPath);
+    logMessage(LOG_INFO, logMsg);
+    closeLogSession();
+    
+    return result;
+}
+
+/**
+ * Komutu çalışan sunucuya gönderir
+ */
+ErrorCode runClient(const char* socketPath, int argc, char* argv[]) {
+    static char frame[PROTOCOL_LENGTH_SIZE + PROTOCOL_MAX_FRAME];
+    char header[PROTOCOL_RESPONSE_HEADER_SIZE];
+    struct sockaddr_un addr;
+    ErrorCode status;
+    uint32_t length;
+    int frameLen;
+    int fd;
+    
+    frameLen = encodeRequest(frame, sizeof(frame), argc, argv);
+    if (frameLen == -1) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(socketPath) >= sizeof(addr.sun_path)) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    strcpy(addr.sun_path, socketPath);
+    
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd == -1) {
+        return ERROR_UNKNOWN;
+    }
+    
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == -1) {
+        const char* msg = "Sunucuya bağlanılamadı.\n";
+        write(STDERR_FILENO, msg, strlen(msg));
+        close(fd);
+        return ERROR_FILE_NOT_FOUND;
+    }
+    
+    if (sendAll(fd, frame, (size_t)frameLen) == -1 || recvAll(fd, header, sizeof(header)) == -1) {
+        close(fd);
+        return ERROR_UNKNOWN;
+    }
+    
+    decodeResponseHeader(header, &status, &length);
+    
+    // Çıktıyı parça parça standart çıktıya aktar
+    while (length > 0) {
+        size_t chunk = length < sizeof(frame) ? length : sizeof(frame);
+        ssize_t received = recv(fd, frame, chunk, 0);
+        if (received <= 0) {
+            if (received < 0 && errno == EINTR) {
+                continue;
+            }
+            close(fd);
+            return ERROR_UNKNOWN;
+        }
+        write(getOutputFd(), frame, (size_t)received);
+        length -= (uint32_t)received;
+    }
+    
+    close(fd);
+    return status;
+}
@@ -0,0 +1,35 @@
+/**
+ * server.h
+ * Unix soketi üzerinden dosya işlemlerini sunan sunucu ve istemci tanımlamaları
+ */
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include "file_system.h"
+
+#define SERVER_MAX_EVENTS 64
+#define SERVER_MAX_WORKERS 64
+#define SERVER_LISTEN_BACKLOG 128
+
+/**
+ * Verilen Unix soketini dinleyen sunucuyu başlatır. Bağlantılar epoll olay
+ * döngüsünde kabul edilir, tamamlanan istekler işçi iş parçacıklarında
+ * çalıştırılır. SIGINT veya SIGTERM gelene kadar geri dönmez.
+ * 
+ * @param socketPath Dinlenecek soket yolu
+ * @return Başarı durumu
+ */
+ErrorCode runServer(const char* socketPath);
+
+/**
+ * Komutu çalışan sunucuya gönderir, çıktıyı standart çıktıya yazar
+ * 
+ * @param socketPath Sunucu soket yolu
+ * @param argc Argüman sayısı
+ * @param argv Komut adı ve argümanları (argv[0] komut adıdır)
+ * @return Sunucuda çalışan komutun sonucu
+ */
+ErrorCode runClient(const char* socketPath, int argc, char* argv[]);
+
+#endif /* SERVER_H */
@@ -0,0 +1,483 @@
+/**
+ * shm_log.c
+ * Süreçler arası paylaşılan bellek log halkasının implementasyonları
+ *
+ * Halka, sınırlı çok üreticili/çok tüketicili sıra algoritmasını kullanır:
+ * her slotun sıra numarası, slotun yazılmaya mı yoksa okunmaya mı hazır
+ * olduğunu belirtir. Üreticiler yalnızca atomik işlemler kullanır.
+ * Boşaltıcılar paylaşılan, sağlam (robust) bir mutex ile sıralanır; böylece
+ * kayıtlar dosyaya eklenme sırasıyla yazılır ve boşaltırken ölen bir süreç
+ * halkayı kilitli bırakmaz.
+ *
+ * Sırayı ayırıp kaydı yayımlamadan ölen bir üretici halkayı tıkar: boşaltıcı
+ * o slotu beklerken sonraki kayıtlar okunamaz. Slot SHM_LOG_STALL_NS süresince
+ * bu durumda kalır ve sahibi olan süreç artık yoksa boşaltıcı slotu atlar.
+ */
+
+#include "shm_log.h"
+#include "logger.h"
+#include "utils.h"
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+
+#define SHM_LOG_MAGIC 0x46534C52u   // "FSLR"
+#define SHM_LOG_VERSION 2
+#define SHM_LOG_STALL_NS 1000000000LL  // Yayımlanmayan slot için bekleme süresi
+
+/**
+ * Halkadaki tek bir kayıt
+ */
+typedef struct {
+    _Atomic uint64_t sequence;
+    _Atomic int32_t owner;      // Sırayı ayıran sürecin pid değeri (0: henüz yazılmadı)
+    uint32_t length;
+    char data[MAX_CONTENT_LENGTH];
+} ShmLogSlot;
+
+/**
+ * Paylaşılan bellekteki halka düzeni
+ */
+typedef struct {
+    _Atomic uint32_t magic;
+    uint32_t version;
+    uint32_t slotCount;
+    pthread_mutex_t drainLock;
+    uint64_t stallPos;          // Yayımlanmasını beklenen slot (drainLock ile korunur)
+    int64_t stallSinceNs;       // Beklemenin başladığı an (CLOCK_MONOTONIC)
+    char pad1[64];
+    _Atomic uint64_t enqueuePos;
+    char pad2[64];
+    _Atomic uint64_t dequeuePos;
+    char pad3[64];
+    ShmLogSlot slots[SHM_LOG_SLOTS];
+} ShmLogRing;
+
+static ShmLogRing* ring = NULL;
+
+// Boşaltıcı iş parçacığının kayıt tamponu; closeShmLog veya iş parçacığı
+// sonlanırken serbest bırakılır
+static __thread char* drainBatch = NULL;
+static pthread_key_t drainBatchKey;
+static pthread_once_t drainBatchOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * Yeni oluşturulan halkayı başlatır
+ */
+static void initializeRing(ShmLogRing* r) {
+    pthread_mutexattr_t attr;
+    
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&r->drainLock, &attr);
+    pthread_mutexattr_destroy(&attr);
+    
+    r->version = SHM_LOG_VERSION;
+    r->slotCount = SHM_LOG_SLOTS;
+    atomic_store(&r->enqueuePos, 0);
+    atomic_store(&r->dequeuePos, 0);
+    r->stallPos = UINT64_MAX;
+    r->stallSinceNs = 0;
+    for (uint64_t i = 0; i < SHM_LOG_SLOTS; i++) {
+        atomic_store_explicit(&r->slots[i].sequence, i, memory_order_relaxed);
+        atomic_store_explicit(&r->slots[i].owner, 0, memory_order_relaxed);
+    }
+    
+    // Diğer süreçler sihirli sayıyı gördüğünde halka hazırdır
+    atomic_store_explicit(&r->magic, SHM_LOG_MAGIC, memory_order_release);
+}
+
+/**
+ * Paylaşılan halkaya bağlanır, yoksa oluşturur
+ */
+ErrorCode openShmLog() {
+    int fd;
+    int created = 0;
+    
+    if (ring != NULL) {
+        return SUCCESS;
+    }
+    
+    // Önce oluşturmayı dene; varsa mevcut halkayı aç
+    fd = shm_open(SHM_LOG_NAME, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd != -1) {
+        created = 1;
+        if (ftruncate(fd, sizeof(ShmLogRing)) == -1) {
+            close(fd);
+            shm_unlink(SHM_LOG_NAME);
+            return ERROR_UNKNOWN;
+        }
+    } else if (errno == EEXIST) {
+        fd = shm_open(SHM_LOG_NAME, O_RDWR, 0644);
+    }
+    if (fd == -1) {
+        return (errno == EACCES) ? ERROR_PERMISSION_DENIED : ERROR_UNKNOWN;
+    }
+    
+    // Oluşturan süreç boyutu ayarlayana kadar bekle
+    struct stat st;
+    for (int i = 0; !created; i++) {
+        if (fstat(fd, &st) == -1 || i > 1000) {
+            close(fd);
+            return ERROR_UNKNOWN;
+        }
+        if ((size_t)st.st_size >= sizeof(ShmLogRing)) {
+            break;
+        }
+        sched_yield();
+    }
+    
+    ShmLogRing* mapped = mmap(NULL, sizeof(ShmLogRing), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        return ERROR_UNKNOWN;
+    }
+    
+    if (created) {
+        initializeRing(mapped);
+    } else {
+        // Oluşturan süreç başlatmayı bitirene kadar bekle
+        int i;
+        for (i = 0; i < 1000 && atomic_load_explicit(&mapped->magic, memory_order_acquire) != SHM_LOG_MAGIC; i++) {
+            sched_yield();
+        }
+        if (i == 1000 || mapped->version != SHM_LOG_VERSION || mapped->slotCount != SHM_LOG_SLOTS) {
+            munmap(mapped, sizeof(ShmLogRing));
+            return ERROR_UNKNOWN;
+        }
+    }
+    
+    ring = mapped;
+    return SUCCESS;
+}
+
+/**
+ * İş parçacığı sonlanırken boşaltma tamponunu serbest bırakır
+ */
+static void freeDrainBatch(void* batch) {
+    free(batch);
+}
+
+/**
+ * Tampon anahtarını bir kez oluşturur
+ */
+static void createDrainBatchKey() {
+    pthread_key_create(&drainBatchKey, freeDrainBatch);
+}
+
+/**
+ * Halkada kalan kayıtları aktarır ve halkadan ayrılır
+ */
+void closeShmLog() {
+    if (ring == NULL) {
+        return;
+    }
+    
+    drainShmLog(1);
+    munmap(ring, sizeof(ShmLogRing));
+    ring = NULL;
+    
+    if (drainBatch != NULL) {
+        pthread_setspecific(drainBatchKey, NULL);
+        free(drainBatch);
+        drainBatch = NULL;
+    }
+}
+
+/**
+ * Halkanın etkin olup olmadığını döndürür
+ */
+int isShmLogActive() {
+    return ring != NULL;
+}
+
+/**
+ * Halkaya bir kayıt eklemeyi dener
+ * 
+ * @return 1: Eklendi, 0: Halka dolu
+ */
+static int tryEnqueue(const char* line, size_t length) {
+    uint64_t mask = SHM_LOG_SLOTS - 1;
+    uint64_t pos = atomic_load_explicit(&ring->enqueuePos, memory_order_relaxed);
+    
+    for (;;) {
+        ShmLogSlot* slot = &ring->slots[pos & mask];
+        uint64_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int64_t diff = (int64_t)seq - (int64_t)pos;
+        
+        if (diff == 0) {
+            // Slot boş: sırayı ayır
+            if (atomic_compare_exchange_weak_explicit(&ring->enqueuePos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                atomic_store_explicit(&slot->owner, (int32_t)getpid(), memory_order_relaxed);
+                if (length > sizeof(slot->data)) {
+                    length = sizeof(slot->data);
+                }
+                memcpy(slot->data, line, length);
+                slot->length = (uint32_t)length;
+                
+                // Boşaltıcı slotu sahipsiz sayıp atladıysa kayıt senkron yazılmalı
+                uint64_t expected = pos;
+                return atomic_compare_exchange_strong_explicit(&slot->sequence, &expected, pos + 1,
+                                                               memory_order_release, memory_order_relaxed);
+            }
+        } else if (diff < 0) {
+            return 0;
+        } else {
+            pos = atomic_load_explicit(&ring->enqueuePos, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * Halkadan sıradaki kaydı alır
+ * 
+ * @return 1: Kayıt alındı, 0: Halka boş veya sıradaki kayıt henüz tamamlanmadı
+ */
+static int tryDequeue(char* buffer, size_t* length) {
+    uint64_t mask = SHM_LOG_SLOTS - 1;
+    uint64_t pos = atomic_load_explicit(&ring->dequeuePos, memory_order_relaxed);
+    
+    for (;;) {
+        ShmLogSlot* slot = &ring->slots[pos & mask];
+        uint64_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int64_t diff = (int64_t)seq - (int64_t)(pos + 1);
+        
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ring->dequeuePos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                *length = slot->length;
+                memcpy(buffer, slot->data, slot->length);
+                // Slotu bir sonraki tur için üreticilere geri ver
+                atomic_store_explicit(&slot->owner, 0, memory_order_relaxed);
+                atomic_store_explicit(&slot->sequence, pos + mask + 1, memory_order_release);
+                return 1;
+            }
+        } else if (diff < 0) {
+            return 0;
+        } else {
+            pos = atomic_load_explicit(&ring->dequeuePos, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * Sırası ayrılmış ama yayımlanmamış slotu, sahibi ölmüşse atlar.
+ * drainLock tutulurken çağrılır.
+ * 
+ * @return 1: Slot atlandı veya yayımlandı (tekrar dene), 0: Beklenecek kayıt yok
+ */
+static int skipStalledSlot(int* skipped) {
+    uint64_t mask = SHM_LOG_SLOTS - 1;
+    uint64_t pos = atomic_load_explicit(&ring->dequeuePos, memory_order_relaxed);
+    ShmLogSlot* slot = &ring->slots[pos & mask];
+    struct timespec now;
+    
+    // Halka boşsa beklenen bir kayıt yoktur
+    if (atomic_load_explicit(&ring->enqueuePos, memory_order_relaxed) <= pos) {
+        ring->stallPos = UINT64_MAX;
+        return 0;
+    }
+    if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != pos) {
+        return 1;
+    }
+    
+    // Beklemenin ne zaman başladığını kaydet
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t nowNs = timespecToNs(&now);
+    if (ring->stallPos != pos) {
+        ring->stallPos = pos;
+        ring->stallSinceNs = nowNs;
+        return 0;
+    }
+    if (nowNs - ring->stallSinceNs < SHM_LOG_STALL_NS) {
+        return 0;
+    }
+    
+    // Sahip henüz yazılmadıysa üretici slotu ayırmakla meşguldür; sahibi hâlâ
+    // çalışıyorsa yalnızca yavaştır. Her iki durumda da beklemeye devam et.
+    pid_t owner = atomic_load_explicit(&slot->owner, memory_order_relaxed);
+    if (owner == 0 || kill(owner, 0) == 0 || errno != ESRCH) {
+        return 0;
+    }
+    
+    // Slotu bir sonraki tura geçir; geç kalan üreticinin yayımlaması başarısız olur
+    uint64_t expected = pos;
+    atomic_store_explicit(&slot->owner, 0, memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&slot->sequence, &expected, pos + mask + 1,
+                                                 memory_order_release, memory_order_acquire)) {
+        return 1;
+    }
+    atomic_store_explicit(&ring->dequeuePos, pos + 1, memory_order_relaxed);
+    ring->stallPos = UINT64_MAX;
+    (*skipped)++;
+    return 1;
+}
+
+/**
+ * Kaydın ikili log kaydı olup olmadığını kontrol eder (metin satırları '[' ile başlar)
+ */
+static int isBinaryRecord(const struct iovec* record) {
+    uint32_t magic;
+    
+    if (record->iov_len < sizeof(BinaryLogHeader)) {
+        return 0;
+    }
+    memcpy(&magic, record->iov_base, sizeof(magic));
+    return magic == LOG_BINARY_MAGIC;
+}
+
+/**
+ * Halkadaki kayıtları sırasıyla log dosyasına yazar
+ */
+ErrorCode drainShmLog(int wait) {
+    struct iovec iov[SHM_LOG_DRAIN_BATCH];
+    ErrorCode result = SUCCESS;
+    int lockResult;
+    int skipped = 0;
+    
+    if (ring == NULL) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    if (drainBatch == NULL) {
+        drainBatch = malloc((size_t)SHM_LOG_DRAIN_BATCH * MAX_CONTENT_LENGTH);
+        if (drainBatch == NULL) {
+            return ERROR_UNKNOWN;
+        }
+        pthread_once(&drainBatchOnce, createDrainBatchKey);
+        pthread_setspecific(drainBatchKey, drainBatch);
+    }
+    char* batch = drainBatch;
+    
+    // Aynı anda tek boşaltıcı; kilit sahibi öldüyse kilidi devral
+    lockResult = wait ? pthread_mutex_lock(&ring->drainLock) : pthread_mutex_trylock(&ring->drainLock);
+    if (lockResult == EOWNERDEAD) {
+        pthread_mutex_consistent(&ring->drainLock);
+    } else if (lockResult != 0) {
+        return (lockResult == EBUSY) ? SUCCESS : ERROR_UNKNOWN;
+    }
+    
+    for (;;) {
+        int count = 0;
+        
+        while (count < SHM_LOG_DRAIN_BATCH) {
+            size_t length;
+            char* slot = batch + (size_t)count * MAX_CONTENT_LENGTH;
+            if (!tryDequeue(slot, &length)) {
+                break;
+            }
+            iov[count].iov_base = slot;
+            iov[count].iov_len = length;
+            count++;
+        }
+        
+        if (count == 0) {
+            if (skipStalledSlot(&skipped)) {
+                continue;
+            }
+            break;
+        }
+        
+        // Halkada farklı biçimdeki süreçlerin kayıtları bulunabilir; ardışık
+        // aynı biçimdeki kayıtlar kendi log dosyasına birlikte yazılır
+        int start = 0;
+        while (start < count && result == SUCCESS) {
+            LogFormat format = isBinaryRecord(&iov[start]) ? LOG_FORMAT_BINARY : LOG_FORMAT_TEXT;
+            int end = start + 1;
+            while (end < count && (isBinaryRecord(&iov[end]) ? LOG_FORMAT_BINARY : LOG_FORMAT_TEXT) == format) {
+                end++;
+            }
+            result = appendLogRecords(format, iov + start, end - start);
+            start = end;
+        }
+        if (result != SUCCESS) {
+            break;
+        }
+    }
+    
+    pthread_mutex_unlock(&ring->drainLock);
+    
+    if (skipped > 0) {
+        char message[MAX_CONTENT_LENGTH];
+        string_format(message, sizeof(message),
+                      "Log halkasında ölmüş süreçlerden kalan %d yayımlanmamış kayıt atlandı", skipped);
+        logMessage(LOG_WARNING, message);
+    }
+    
+    return result;
+}
+
+/**
+ * Kaydı halkaya ekler; halka doluysa önce boşaltır
+ */
+int shmLogAppend(const char* line, size_t length) {
+    if (ring == NULL) {
+        return 0;
+    }
+    
+    for (int attempt = 0; attempt < 3; attempt++) {
+        if (tryEnqueue(line, length)) {
+            return 1;
+        }
+        // Halka dolu: bu süreç boşaltıcı olur
+        drainShmLog(1);
+    }
+    
+    return 0;
+}
+
+// logd döngüsünü durduran sinyal bayrağı
+static volatile sig_atomic_t logDaemonStopping = 0;
+
+/**
+ * logd sonlandırma sinyali
+ */
+static void stopLogDaemon(int sig) {
+    (void)sig;
+    logDaemonStopping = 1;
+}
+
+/**
+ * Halkayı periyodik olarak boşaltan log sürecini çalıştırır
+ */
+ErrorCode runLogDaemon(int intervalMs) {
+    struct sigaction sa;
+    ErrorCode result;
+    
+    if (intervalMs <= 0) {
+        intervalMs = SHM_LOG_DEFAULT_INTERVAL_MS;
+    }
+    
+    result = openShmLog();
+    if (result != SUCCESS) {
+        return result;
+    }
+    
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = stopLogDaemon;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    
+    logMessage(LOG_INFO, "Log süreci başlatıldı");
+    
+    struct timespec interval;
+    interval.tv_sec = intervalMs / 1000;
+    interval.tv_nsec = (long)(intervalMs % 1000) * 1000000L;
+    
+    while (!logDaemonStopping) {
+        drainShmLog(1);
+        nanosleep(&interval, NULL);
+    }
+    
+    logMessage(LOG_INFO, "Log süreci durduruldu");
+    closeShmLog();
+    
+    return SUCCESS;
+}
@@ -0,0 +1,67 @@
+/**
+ * shm_log.h
+ * Süreçler arası paylaşılan bellek log halkası için fonksiyon tanımlamaları
+ *
+ * Aynı anda çalışan file_system süreçleri log kayıtlarını shm_open ile
+ * paylaşılan, kilitsiz, çok üreticili bir halkaya ekler. Kayıtlar eklenme
+ * sırasıyla log dosyasına "logd" komutu veya halkayı dolu bulan / sonlanan
+ * süreç tarafından aktarılır.
+ */
+
+#ifndef SHM_LOG_H
+#define SHM_LOG_H
+
+#include "file_system.h"
+
+#define SHM_LOG_NAME "/file_system_log"
+#define SHM_LOG_SLOTS 4096              // 2'nin kuvveti olmalı
+#define SHM_LOG_DRAIN_BATCH 256
+#define SHM_LOG_DEFAULT_INTERVAL_MS 10
+
+/**
+ * Paylaşılan halkaya bağlanır, yoksa oluşturur. Bu çağrıdan sonra
+ * logMessage kayıtları halkaya ekler.
+ * 
+ * @return Başarı durumu
+ */
+ErrorCode openShmLog();
+
+/**
+ * Halkada kalan kayıtları dosyaya aktarır ve halkadan ayrılır
+ */
+void closeShmLog();
+
+/**
+ * Paylaşılan halkanın bu süreçte etkin olup olmadığını döndürür
+ * 
+ * @return 1: Etkin, 0: Değil
+ */
+int isShmLogActive();
+
+/**
+ * Kaydı halkaya ekler; halka doluysa önce halkayı dosyaya boşaltır
+ * 
+ * @param line Log satırı
+ * @param length Satır uzunluğu
+ * @return 1: Eklendi, 0: Eklenemedi (senkron yazılmalı)
+ */
+int shmLogAppend(const char* line, size_t length);
+
+/**
+ * Halkadaki kayıtları sırasıyla log dosyasına yazar
+ * 
+ * @param wait 1: Başka bir boşaltıcı çalışıyorsa bekle, 0: Bekleme
+ * @return Başarı durumu
+ */
+ErrorCode drainShmLog(int wait);
+
+/**
+ * Halkayı periyodik olarak boşaltan log sürecini çalıştırır (logd komutu).
+ * SIGINT veya SIGTERM gelene kadar geri dönmez.
+ * 
+ * @param intervalMs Boşaltma aralığı (ms, <= 0 ise varsayılan)
+ * @return Başarı durumu
+ */
+ErrorCode runLogDaemon(int intervalMs);
+
+#endif /* SHM_LOG_H */
@@ -3,8 +3,147 @@
  * Yardımcı fonksiyonların implementasyonları
  */
 
+#define _GNU_SOURCE
 #include "utils.h"
+#include "logger.h"
 #include <stdarg.h>
+#include <limits.h>
+
+// İşlem çıktılarının yazıldığı dosya tanımlayıcısı (her iş parçacığı için ayrı)
+static __thread int outputFd = STDOUT_FILENO;
+
+/**
+ * "offset:length" biçimindeki aralığı çözer (length boş bırakılırsa dosya sonuna kadar)
+ */
+static ErrorCode parseRange(const char* text, long long* offset, long long* length) {
+    char* end;
+    
+    errno = 0;
+    *offset = strtoll(text, &end, 10);
+    if (errno != 0 || end == text || *end != ':' || *offset < 0) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    text = end + 1;
+    if (*text == '\0') {
+        *length = -1;
+        return SUCCESS;
+    }
+    
+    *length = strtoll(text, &end, 10);
+    if (errno != 0 || end == text || *end != '\0' || *length < 0) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    return SUCCESS;
+}
+
+/**
+ * Zaman değerini nanosaniyeye çevirir
+ * 
+ * Epoch saniyesi, "YYYY-MM-DD HH:MM:SS" veya "YYYY-MM-DD" (yerel saat) kabul edilir.
+ * endOfPeriod verilirse belirtilen saniyenin/günün sonu döndürülür (--until için).
+ */
+static ErrorCode parseTimeValue(const char* text, int endOfPeriod, long long* ns) {
+    struct tm tmValue;
+    char* end;
+    long long span = 1;
+    
+    errno = 0;
+    long long seconds = strtoll(text, &end, 10);
+    if (errno == 0 && end != text && *end == '\0') {
+        if (seconds < 0) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+    } else {
+        memset(&tmValue, 0, sizeof(tmValue));
+        end = strptime(text, "%Y-%m-%d %H:%M:%S", &tmValue);
+        if (end == NULL || *end != '\0') {
+            memset(&tmValue, 0, sizeof(tmValue));
+            end = strptime(text, "%Y-%m-%d", &tmValue);
+            if (end == NULL || *end != '\0') {
+                return ERROR_INVALID_ARGUMENT;
+            }
+            span = 86400;
+        }
+        tmValue.tm_isdst = -1;
+        seconds = (long long)mktime(&tmValue);
+        if (seconds < 0) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+    }
+    
+    *ns = seconds * 1000000000LL;
+    if (endOfPeriod) {
+        *ns += span * 1000000000LL - 1;
+    }
+    return SUCCESS;
+}
+
+/**
+ * showLogs filtre seçeneklerini çözer
+ */
+static ErrorCode parseLogFilters(int argc, char* argv[], Command* cmd) {
+    for (int i = 2; i < argc; i += 2) {
+        if (i + 1 >= argc) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        
+        const char* value = argv[i + 1];
+        if (strcmp(argv[i], "--since") == 0) {
+            if (parseTimeValue(value, 0, &cmd->sinceNs) != SUCCESS) {
+                return ERROR_INVALID_ARGUMENT;
+            }
+        } else if (strcmp(argv[i], "--until") == 0) {
+            if (parseTimeValue(value, 1, &cmd->untilNs) != SUCCESS) {
+                return ERROR_INVALID_ARGUMENT;
+            }
+        } else if (strcmp(argv[i], "--type") == 0) {
+            if (strcmp(value, "INFO") == 0) {
+                cmd->logType = LOG_INFO;
+            } else if (strcmp(value, "ERROR") == 0) {
+                cmd->logType = LOG_ERROR;
+            } else if (strcmp(value, "WARNING") == 0) {
+                cmd->logType = LOG_WARNING;
+            } else {
+                return ERROR_INVALID_ARGUMENT;
+            }
+        } else if (strcmp(argv[i], "--limit") == 0) {
+            char* end;
+            long limit = strtol(value, &end, 10);
+            if (end == value || *end != '\0' || limit <= 0 || limit > INT_MAX) {
+                return ERROR_INVALID_ARGUMENT;
+            }
+            cmd->limit = (int)limit;
+        } else {
+            return ERROR_INVALID_ARGUMENT;
+        }
+    }
+    
+    return SUCCESS;
+}
+
+/**
+ * Listeleme seçeneklerini (-r, --unordered) çözer
+ */
+static ErrorCode parseListFlags(int argc, char* argv[], int first, Command* cmd) {
+    for (int i = first; i < argc; i++) {
+        if (strcmp(argv[i], "-r") == 0) {
+            cmd->flags |= CMD_FLAG_RECURSIVE;
+        } else if (strcmp(argv[i], "--unordered") == 0) {
+            cmd->flags |= CMD_FLAG_UNORDERED;
+        } else {
+            return ERROR_INVALID_ARGUMENT;
+        }
+    }
+    
+    // Sırasız çıktı yalnızca alt dizinlerle listelemede anlamlıdır
+    if ((cmd->flags & CMD_FLAG_UNORDERED) && !(cmd->flags & CMD_FLAG_RECURSIVE)) {
+        return ERROR_INVALID_ARGUMENT;
+    }
+    
+    return SUCCESS;
+}
 
 /**
  * Komut satırı argümanlarını işler ve komut yapısını doldurur
@@ -14,6 +153,15 @@ ErrorCode parseCommand(int argc, char* argv[], Command* cmd) {
         return ERROR_INVALID_ARGUMENT;
     }
     
+    cmd->offset = 0;
+    cmd->length = -1;
+    cmd->sinceNs = 0;
+    cmd->untilNs = 0;
+    cmd->logType = -1;
+    cmd->limit = 0;
+    cmd->flags = 0;
+    cmd->content = NULL;
+    
     // Komut adını belirle
     if (strcmp(argv[1], "createDir") == 0) {
         cmd->type = CMD_CREATE_DIR;
@@ -38,8 +186,8 @@ ErrorCode parseCommand(int argc, char* argv[], Command* cmd) {
     } else if (strcmp(argv[1], "listDir") == 0) {
         cmd->type = CMD_LIST_DIR;
         
-        // listDir "folderName"
-        if (argc != 3) {
+        // listDir "folderName" [-r [--unordered]]
+        if (argc < 3 || parseListFlags(argc, argv, 3, cmd) != SUCCESS) {
             return ERROR_INVALID_ARGUMENT;
         }
         
@@ -48,30 +196,113 @@ ErrorCode parseCommand(int argc, char* argv[], Command* cmd) {
     } else if (strcmp(argv[1], "listFilesByExtension") == 0) {
         cmd->type = CMD_LIST_FILES_BY_EXTENSION;
         
-        // listFilesByExtension "folderName" ".txt"
-        if (argc != 4) {
+        // listFilesByExtension "folderName" ".txt" [-r [--unordered]]
+        if (argc < 4 || parseListFlags(argc, argv, 4, cmd) != SUCCESS) {
             return ERROR_INVALID_ARGUMENT;
         }
         
         strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
         cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
         
+        strncpy(cmd->arg2, argv[3], MAX_PATH_LENGTH - 1);
+        cmd->arg2[MAX_PATH_LENGTH - 1] = '\0';
+    } else if (strcmp(argv[1], "filterFiles") == 0) {
+        cmd->type = CMD_FILTER_FILES;
+        
+        // filterFiles "folderName" ".txt,.csv,rapor_*.log" [-r [--unordered]]
+        if (argc < 4 || parseListFlags(argc, argv, 4, cmd) != SUCCESS) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        
+        strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
+        cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
+        
+        strncpy(cmd->arg2, argv[3], MAX_PATH_LENGTH - 1);
+        cmd->arg2[MAX_PATH_LENGTH - 1] = '\0';
+    } else if (strcmp(argv[1], "searchContent") == 0) {
+        cmd->type = CMD_SEARCH_CONTENT;
+        
+        // searchContent "folderName" "text" [-r] [--max-kb N]
+        if (argc < 4 || argv[3][0] == '\0') {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        for (int i = 4; i < argc; i++) {
+            if (strcmp(argv[i], "-r") == 0) {
+                cmd->flags |= CMD_FLAG_RECURSIVE;
+            } else if (strcmp(argv[i], "--max-kb") == 0 && i + 1 < argc) {
+                char* end;
+                long maxKb = strtol(argv[++i], &end, 10);
+                if (end == argv[i] || *end != '\0' || maxKb <= 0 || maxKb > INT_MAX) {
+                    return ERROR_INVALID_ARGUMENT;
+                }
+                cmd->limit = (int)maxKb;
+            } else {
+                return ERROR_INVALID_ARGUMENT;
+            }
+        }
+        
+        strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
+        cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
+        
         strncpy(cmd->arg2, argv[3], MAX_PATH_LENGTH - 1);
         cmd->arg2[MAX_PATH_LENGTH - 1] = '\0';
     } else if (strcmp(argv[1], "readFile") == 0) {
         cmd->type = CMD_READ_FILE;
         
-        // readFile "fileName"
-        if (argc != 3) {
+        // readFile "fileName" [--range offset:length | --head N | --tail N] [--follow]
+        if (argc > 3 && strcmp(argv[argc - 1], "--follow") == 0) {
+            cmd->flags |= CMD_FLAG_FOLLOW;
+            argc--;
+        }
+        if (argc != 3 && argc != 5) {
             return ERROR_INVALID_ARGUMENT;
         }
         
         strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
         cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
+        
+        // Takip modu yalnızca tüm içerikten veya son satırlardan başlayabilir
+        if ((cmd->flags & CMD_FLAG_FOLLOW) && argc == 5 && strcmp(argv[3], "--tail") != 0) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        
+        if (argc == 5 && (strcmp(argv[3], "--head") == 0 || strcmp(argv[3], "--tail") == 0)) {
+            char* end;
+            long lines = strtol(argv[4], &end, 10);
+            if (end == argv[4] || *end != '\0' || lines < 0 || lines > INT_MAX) {
+                return ERROR_INVALID_ARGUMENT;
+            }
+            cmd->limit = (int)lines;
+            cmd->flags |= (argv[3][2] == 'h') ? CMD_FLAG_HEAD : CMD_FLAG_TAIL;
+        } else if (argc == 5) {
+            if (strcmp(argv[3], "--range") != 0 ||
+                parseRange(argv[4], &cmd->offset, &cmd->length) != SUCCESS) {
+                return ERROR_INVALID_ARGUMENT;
+            }
+        }
     } else if (strcmp(argv[1], "appendToFile") == 0) {
         cmd->type = CMD_APPEND_TO_FILE;
         
-        // appendToFile "fileName" "new content"
+        // appendToFile "fileName" ("new content" | --stdin | --from "sourceFile")
+        if (argc == 4 && strcmp(argv[3], "--stdin") == 0) {
+            cmd->flags |= CMD_FLAG_STDIN;
+        } else if (argc == 5 && strcmp(argv[3], "--from") == 0) {
+            cmd->flags |= CMD_FLAG_FROM_FILE;
+            strncpy(cmd->arg2, argv[4], MAX_PATH_LENGTH - 1);
+            cmd->arg2[MAX_PATH_LENGTH - 1] = '\0';
+        } else if (argc == 4) {
+            // İçerik kopyalanmaz; komut argv geçerliyken çalıştırılır
+            cmd->content = argv[3];
+        } else {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        
+        strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
+        cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
+    } else if (strcmp(argv[1], "copyFile") == 0 || strcmp(argv[1], "moveFile") == 0) {
+        cmd->type = (argv[1][0] == 'c') ? CMD_COPY_FILE : CMD_MOVE_FILE;
+        
+        // copyFile "source" "destination", moveFile "source" "destination"
         if (argc != 4) {
             return ERROR_INVALID_ARGUMENT;
         }
@@ -81,6 +312,38 @@ ErrorCode parseCommand(int argc, char* argv[], Command* cmd) {
         
         strncpy(cmd->arg2, argv[3], MAX_PATH_LENGTH - 1);
         cmd->arg2[MAX_PATH_LENGTH - 1] = '\0';
+    } else if (strcmp(argv[1], "copyDir") == 0) {
+        cmd->type = CMD_COPY_DIR;
+        
+        // copyDir "source" "destination" [--max-inflight-mb N]
+        if (argc == 6 && strcmp(argv[4], "--max-inflight-mb") == 0) {
+            char* end;
+            long maxInFlightMb = strtol(argv[5], &end, 10);
+            if (end == argv[5] || *end != '\0' || maxInFlightMb <= 0 || maxInFlightMb > INT_MAX) {
+                return ERROR_INVALID_ARGUMENT;
+            }
+            cmd->limit = (int)maxInFlightMb;
+        } else if (argc != 4) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        
+        strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
+        cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
+        
+        strncpy(cmd->arg2, argv[3], MAX_PATH_LENGTH - 1);
+        cmd->arg2[MAX_PATH_LENGTH - 1] = '\0';
+    } else if (strcmp(argv[1], "checksum") == 0) {
+        cmd->type = CMD_CHECKSUM;
+        
+        // checksum "fileName" [--no-cache]
+        if (argc == 4 && strcmp(argv[3], "--no-cache") == 0) {
+            cmd->flags |= CMD_FLAG_NO_CACHE;
+        } else if (argc != 3) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        
+        strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
+        cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
     } else if (strcmp(argv[1], "deleteFile") == 0) {
         cmd->type = CMD_DELETE_FILE;
         
@@ -94,8 +357,10 @@ ErrorCode parseCommand(int argc, char* argv[], Command* cmd) {
     } else if (strcmp(argv[1], "deleteDir") == 0) {
         cmd->type = CMD_DELETE_DIR;
         
-        // deleteDir "folderName"
-        if (argc != 3) {
+        // deleteDir "folderName" [-r]
+        if (argc == 4 && strcmp(argv[3], "-r") == 0) {
+            cmd->flags |= CMD_FLAG_RECURSIVE;
+        } else if (argc != 3) {
             return ERROR_INVALID_ARGUMENT;
         }
         
@@ -104,10 +369,69 @@ ErrorCode parseCommand(int argc, char* argv[], Command* cmd) {
     } else if (strcmp(argv[1], "showLogs") == 0) {
         cmd->type = CMD_SHOW_LOGS;
         
-        // showLogs
-        if (argc != 2) {
+        // showLogs [--since T] [--until T] [--type TYPE] [--limit N]
+        if (parseLogFilters(argc, argv, cmd) != SUCCESS) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+    } else if (strcmp(argv[1], "batch") == 0) {
+        cmd->type = CMD_BATCH;
+        
+        // batch ["commandFile"] (dosya verilmezse standart girdi okunur)
+        if (argc != 2 && argc != 3) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        
+        cmd->arg1[0] = '\0';
+        if (argc == 3) {
+            strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
+            cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
+        }
+    } else if (strcmp(argv[1], "appendBatch") == 0) {
+        cmd->type = CMD_APPEND_BATCH;
+        
+        // appendBatch ["recordFile"] (satırlar "dosya<TAB>içerik"; dosya verilmezse standart girdi)
+        if (argc != 2 && argc != 3) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        
+        cmd->arg1[0] = '\0';
+        if (argc == 3) {
+            strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
+            cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
+        }
+    } else if (strcmp(argv[1], "serve") == 0) {
+        cmd->type = CMD_SERVE;
+        
+        // serve ["socketPath"]
+        if (argc != 2 && argc != 3) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        
+        strncpy(cmd->arg1, (argc == 3) ? argv[2] : DEFAULT_SOCKET_PATH, MAX_PATH_LENGTH - 1);
+        cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
+    } else if (strcmp(argv[1], "client") == 0) {
+        cmd->type = CMD_CLIENT;
+        
+        // client "socketPath" <komut> [argümanlar...]
+        if (argc < 4) {
+            return ERROR_INVALID_ARGUMENT;
+        }
+        
+        strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
+        cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
+    } else if (strcmp(argv[1], "logd") == 0) {
+        cmd->type = CMD_LOGD;
+        
+        // logd ["intervalMs"]
+        if (argc != 2 && argc != 3) {
             return ERROR_INVALID_ARGUMENT;
         }
+        
+        cmd->arg1[0] = '\0';
+        if (argc == 3) {
+            strncpy(cmd->arg1, argv[2], MAX_PATH_LENGTH - 1);
+            cmd->arg1[MAX_PATH_LENGTH - 1] = '\0';
+        }
     } else if (strcmp(argv[1], "help") == 0 || strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-h") == 0) {
         cmd->type = CMD_HELP;
     } else {
@@ -118,6 +442,67 @@ ErrorCode parseCommand(int argc, char* argv[], Command* cmd) {
     return SUCCESS;
 }
 
+/**
+ * Bir komut satırını argümanlara ayırır
+ */
+int splitCommandLine(char* line, char* argv[], int maxArgs) {
+    int argc = 0;
+    char* src = line;
+    char* dst = line;
+    
+    if (line == NULL || argv == NULL || maxArgs <= 0) {
+        return -1;
+    }
+    
+    while (*src != '\0') {
+        // Boşlukları atla
+        while (*src == ' ' || *src == '\t' || *src == '\r' || *src == '\n') {
+            src++;
+        }
+        if (*src == '\0') {
+            break;
+        }
+        
+        if (argc >= maxArgs) {
+            return -1;
+        }
+        argv[argc++] = dst;
+        
+        // Bir argümanı oku; tırnaklar argümanın parçası değildir
+        char quote = '\0';
+        while (*src != '\0') {
+            if (quote == '\0' && (*src == ' ' || *src == '\t' || *src == '\r' || *src == '\n')) {
+                break;
+            }
+            if (quote == '\0' && (*src == '"' || *src == '\'')) {
+                quote = *src++;
+                continue;
+            }
+            if (quote != '\0' && *src == quote) {
+                quote = '\0';
+                src++;
+                continue;
+            }
+            if (*src == '\\' && quote != '\'' && src[1] != '\0') {
+                src++;
+            }
+            *dst++ = *src++;
+        }
+        
+        // Kapanmamış tırnak
+        if (quote != '\0') {
+            return -1;
+        }
+        
+        if (*src != '\0') {
+            src++;
+        }
+        *dst++ = '\0';
+    }
+    
+    return argc;
+}
+
 /**
  * Hata koduna göre uygun hata mesajını döndürür
  */
@@ -135,6 +520,8 @@ const char* getErrorMessage(ErrorCode code) {
             return "İzin reddedildi";
         case ERROR_INVALID_ARGUMENT:
             return "Geçersiz argüman";
+        case ERROR_LOCK_TIMEOUT:
+            return "Kilit zaman aşımı (dosya başka bir işlem tarafından kilitli)";
         case ERROR_UNKNOWN:
         default:
             return "Bilinmeyen hata";
@@ -177,10 +564,48 @@ int string_format(char* buffer, size_t size, const char* format, ...) {
                 }
                 break;
             }
+            case 'l': // long / long long uzunluk belirteci
+            case 'u':
             case 'd': { // Integer
-                int num = va_arg(args, int);
-                char num_str[20]; // int için yeterli
+                int longCount = 0;
+                while (*p == 'l') {
+                    longCount++;
+                    p++;
+                }
+                if (*p != 'd' && *p != 'u') {
+                    p--;
+                    break;
+                }
+                
+                unsigned long long num;
                 int is_negative = 0;
+                if (*p == 'd') {
+                    long long value;
+                    if (longCount >= 2) {
+                        value = va_arg(args, long long);
+                    } else if (longCount == 1) {
+                        value = va_arg(args, long);
+                    } else {
+                        value = va_arg(args, int);
+                    }
+                    // Negatif sayıları işle
+                    if (value < 0) {
+                        is_negative = 1;
+                        num = (unsigned long long)(-(value + 1)) + 1;
+                    } else {
+                        num = (unsigned long long)value;
+                    }
+                } else {
+                    if (longCount >= 2) {
+                        num = va_arg(args, unsigned long long);
+                    } else if (longCount == 1) {
+                        num = va_arg(args, unsigned long);
+                    } else {
+                        num = va_arg(args, unsigned int);
+                    }
+                }
+                
+                char num_str[24]; // 64 bit sayı için yeterli
                 int idx = 0;
                 
                 // Sayı 0 ise doğrudan '0' yaz
@@ -193,12 +618,6 @@ int string_format(char* buffer, size_t size, const char* format, ...) {
                     break;
                 }
                 
-                // Negatif sayıları işle
-                if (num < 0) {
-                    is_negative = 1;
-                    num = -num;
-                }
-                
                 // Sayıyı stringe dönüştür (tersten)
                 while (num > 0) {
                     num_str[idx++] = '0' + (num % 10);
@@ -255,19 +674,49 @@ void showHelp() {
     const char help_msg[] = 
         "Güvenli Dosya ve Dizin Yönetim Sistemi\n"
         "=======================================\n"
-        "Kullanım:\n"
+        "Kullanım: file_system [seçenekler] <komut> [argümanlar]\n"
         "  createDir \"folderName\"              - Dizin oluşturma\n"
         "  createFile \"fileName\"              - Dosya oluşturma\n"
-        "  listDir \"folderName\"               - Dizin içeriği listeleme\n"
-        "  listFilesByExtension \"folderName\" \".txt\" - Belirli uzantıya sahip dosyaları listeleme\n"
-        "  readFile \"fileName\"                - Dosya içeriği okuma\n"
+        "  listDir \"folderName\" [-r [--unordered]] - Dizin içeriği (alt dizinlerle) listeleme\n"
+        "  listFilesByExtension \"folderName\" \".txt\" [-r [--unordered]] - Belirli uzantıya sahip dosyaları listeleme\n"
+        "  filterFiles \"folderName\" \".txt,.csv,rapor_*.log\" [-r [--unordered]] - Uzantı/glob desenlerine uyan dosyaları listeleme\n"
+        "  searchContent \"folderName\" \"text\" [-r] [--max-kb N] - Dosya içeriklerinde metin arama (dosya:satır:konum)\n"
+        "  readFile \"fileName\" [--range off:len | --head N | --tail N] - Dosya içeriği (veya bir aralığı, ilk/son N satırı) okuma\n"
+        "  readFile \"fileName\" [--tail N] --follow - İçeriği yazıp dosyaya eklenenleri izleme\n"
         "  appendToFile \"fileName\" \"new content\" - Dosyaya içerik ekleme\n"
+        "  appendToFile \"fileName\" --stdin | --from \"sourceFile\"\n"
+        "                                     - Standart girdinin/dosyanın içeriğini ekleme (boyut sınırı yok)\n"
+        "  copyFile \"source\" \"destination\"    - Dosya kopyalama (reflink, copy_file_range)\n"
+        "  moveFile \"source\" \"destination\"    - Dosya taşıma (farklı dosya sisteminde kopyala ve sil)\n"
+        "  copyDir \"source\" \"destination\" [--max-inflight-mb N] - Dizini içeriğiyle paralel kopyalama\n"
+        "  checksum \"fileName\" [--no-cache]   - Dosyanın CRC32C sağlama toplamı (xattr'da önbelleğe alınır)\n"
         "  deleteFile \"fileName\"              - Dosya silme\n"
-        "  deleteDir \"folderName\"             - Boş dizin silme\n"
-        "  showLogs                           - Log kayıtlarını gösterme\n"
-        "  help                               - Bu yardım mesajını gösterme\n\n";
+        "  deleteDir \"folderName\" [-r]        - Boş dizin (-r: içeriğiyle birlikte) silme\n"
+        "  showLogs [--since T] [--until T] [--type INFO|ERROR|WARNING] [--limit N]\n"
+        "                                     - Log kayıtlarını (filtreleyerek) gösterme\n"
+        "  batch [\"commandFile\"]              - Komutları dosyadan/standart girdiden toplu çalıştırma\n"
+        "  appendBatch [\"recordFile\"]         - \"dosya<TAB>içerik\" kayıtlarını dosya başına tek kilitle ekleme\n"
+        "  serve [\"socketPath\"]               - Unix soketi üzerinden hizmet veren sunucuyu başlatma\n"
+        "  client \"socketPath\" <komut> ...     - Komutu çalışan sunucuya gönderme\n"
+        "  logd [\"intervalMs\"]                - Paylaşılan log halkasını dosyaya aktaran süreç\n"
+        "  help                               - Bu yardım mesajını gösterme\n\n"
+        "Seçenekler:\n"
+        "  --isolate                          - Listeleme/silme işlemlerini ayrı çocuk işlemde (fork) çalıştırma\n"
+        "  --stats                            - Komut sonunda işlem istatistiklerini standart hataya yazma\n"
+        "  --lock-mode=exclusive|shared       - Dosya kilitleme (shared: okuyanlar paylaşımlı, ekleyenler yalnızca dosya sonunu kilitler)\n"
+        "  --lock-timeout=N[ms]               - Kilit için en fazla N ms bekle (0: tek deneme, varsayılan: süresiz)\n"
+        "  --batch-backend=sync|uring         - batch komutlarının yürütülmesi (uring: bağımsız komutlar io_uring ile birlikte)\n"
+        "  --index                            - listFilesByExtension'da kalıcı uzantı indeksini kullanma\n"
+        "  --threads=N                        - Paralel işlemlerde kullanılacak iş parçacığı sayısı (varsayılan: CPU sayısı)\n"
+        "  --log-async                        - Log kayıtlarını arka planda toplu yazma\n"
+        "  --log-flush-ms=N                   - Asenkron logda en uzun bekleme süresi (ms)\n"
+        "  --log-batch=N                      - Asenkron logda tek yazmadaki en fazla kayıt\n"
+        "  --log-shm                          - Log kayıtlarını süreçler arası paylaşılan halkaya ekleme\n"
+        "  --log-format=text|binary           - Log biçimi (binary: log.bin, metne showLogs'ta çevrilir)\n"
+        "  --log-rotate-kb=N                  - Log dosyası N KB'ı aşınca sıkıştırılmış parçaya döndürme\n"
+        "  --log-rotate-age=N                 - İlk kaydı N saniyeden eski log dosyasını döndürme\n\n";
     
-    write(STDOUT_FILENO, help_msg, strlen(help_msg));
+    write(getOutputFd(), help_msg, strlen(help_msg));
 }
 
 /**
@@ -277,8 +726,10 @@ void getCurrentTimeStamp(char* buffer, size_t size) {
     time_t rawtime;
     struct tm* timeinfo;
     
+    struct tm tmBuffer;
+    
     time(&rawtime);
-    timeinfo = localtime(&rawtime);
+    timeinfo = localtime_r(&rawtime, &tmBuffer);
     
     strftime(buffer, size, "%Y-%m-%d %H:%M:%S", timeinfo);
 }
@@ -302,4 +753,87 @@ int isDirectory(const char* path) {
     }
     
     return S_ISDIR(st.st_mode);
-} 
\ No newline at end of file
+} 
+
+/**
+ * İşlem çıktılarının yazılacağı dosya tanımlayıcısını döndürür
+ */
+int getOutputFd() {
+    return outputFd;
+}
+
+/**
+ * Çağıran iş parçacığı için çıktı dosya tanımlayıcısını ayarlar
+ */
+void setOutputFd(int fd) {
+    outputFd = fd;
+}
+
+/**
+ * timespec değerini nanosaniyeye çevirir
+ */
+int64_t timespecToNs(const struct timespec* ts) {
+    return (int64_t)ts->tv_sec * 1000000000LL + ts->tv_nsec;
+}
+
+/**
+ * İş parçacığı başına satır buffer'ları oluşturur
+ */
+LineBuffer* createLineBuffers(int count, int fd) {
+    LineBuffer* buffers = malloc(sizeof(LineBuffer) * (size_t)count);
+    
+    if (buffers == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < count; i++) {
+        buffers[i].fd = fd;
+        buffers[i].used = 0;
+    }
+    return buffers;
+}
+
+/**
+ * Buffer'ları boşaltır ve serbest bırakır
+ */
+void destroyLineBuffers(LineBuffer* buffers, int count) {
+    if (buffers == NULL) {
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        flushLineBuffer(&buffers[i]);
+    }
+    free(buffers);
+}
+
+/**
+ * Buffer'daki satırları çıktıya yazar
+ */
+void flushLineBuffer(LineBuffer* buffer) {
+    if (buffer->used > 0) {
+        write(buffer->fd, buffer->data, buffer->used);
+        buffer->used = 0;
+    }
+}
+
+/**
+ * Parçalardan oluşan tek bir satırı buffer'a ekler
+ */
+void appendLineBuffer(LineBuffer* buffer, const struct iovec* parts, int count) {
+    size_t lineLength = 0;
+    
+    for (int i = 0; i < count; i++) {
+        lineLength += parts[i].iov_len;
+    }
+    
+    if (sizeof(buffer->data) - buffer->used < lineLength) {
+        flushLineBuffer(buffer);
+    }
+    if (lineLength > sizeof(buffer->data)) {
+        writev(buffer->fd, parts, count);
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        memcpy(buffer->data + buffer->used, parts[i].iov_base, parts[i].iov_len);
+        buffer->used += parts[i].iov_len;
+    }
+}
@@ -7,6 +7,20 @@
 #define UTILS_H
 
 #include "file_system.h"
+#include <stdint.h>
+#include <sys/uio.h>
+
+#define LINE_BUFFER_SIZE 65536      // İş parçacığı başına çıktı buffer'ı
+
+/**
+ * İş parçacığına ait satır buffer'ı. Satırlar buffer'a bütün olarak eklenir;
+ * böylece aynı çıktıya yazan iş parçacıklarının satırları karışmaz.
+ */
+typedef struct {
+    int fd;
+    size_t used;
+    char data[LINE_BUFFER_SIZE];
+} LineBuffer;
 
 /**
  * Güvenli bir şekilde formatlanmış string oluşturur (snprintf yerine)
@@ -29,6 +43,17 @@ int string_format(char* buffer, size_t size, const char* format, ...);
  */
 ErrorCode parseCommand(int argc, char* argv[], Command* cmd);
 
+/**
+ * Bir komut satırını argümanlara ayırır (çift/tek tırnak ve \\ kaçışı desteklenir)
+ * Satır yerinde değiştirilir, argv elemanları satırın içini gösterir.
+ * 
+ * @param line Ayrıştırılacak satır
+ * @param argv Doldurulacak argüman dizisi
+ * @param maxArgs argv dizisinin kapasitesi
+ * @return Bulunan argüman sayısı, hata durumunda -1
+ */
+int splitCommandLine(char* line, char* argv[], int maxArgs);
+
 /**
  * Hata koduna göre uygun hata mesajını döndürür
  * 
@@ -66,4 +91,61 @@ int fileExists(const char* path);
  */
 int isDirectory(const char* path);
 
+/**
+ * İşlem çıktılarının yazılacağı dosya tanımlayıcısını döndürür
+ * (iş parçacığına özeldir, varsayılan STDOUT_FILENO)
+ * 
+ * @return Çıktı dosya tanımlayıcısı
+ */
+int getOutputFd();
+
+/**
+ * Çağıran iş parçacığı için işlem çıktılarının yazılacağı dosya tanımlayıcısını ayarlar
+ * 
+ * @param fd Yeni çıktı dosya tanımlayıcısı
+ */
+void setOutputFd(int fd);
+
+/**
+ * timespec değerini nanosaniyeye çevirir
+ * 
+ * @param ts Zaman
+ * @return Nanosaniye
+ */
+int64_t timespecToNs(const struct timespec* ts);
+
+/**
+ * İş parçacığı başına satır buffer'ları oluşturur
+ * 
+ * @param count Buffer sayısı
+ * @param fd Satırların yazılacağı dosya tanımlayıcısı
+ * @return Buffer dizisi, bellek yetmezse NULL
+ */
+LineBuffer* createLineBuffers(int count, int fd);
+
+/**
+ * Buffer'ları boşaltır ve serbest bırakır
+ * 
+ * @param buffers Buffer dizisi (NULL olabilir)
+ * @param count Buffer sayısı
+ */
+void destroyLineBuffers(LineBuffer* buffers, int count);
+
+/**
+ * Buffer'daki satırları çıktıya yazar
+ * 
+ * @param buffer Buffer
+ */
+void flushLineBuffer(LineBuffer* buffer);
+
+/**
+ * Parçalardan oluşan tek bir satırı buffer'a ekler. Buffer'a sığmayan satır
+ * doğrudan tek writev ile yazılır.
+ * 
+ * @param buffer Buffer
+ * @param parts Satırın parçaları (satır sonu dahil)
+ * @param count Parça sayısı
+ */
+void appendLineBuffer(LineBuffer* buffer, const struct iovec* parts, int count);
+
 #endif /* UTILS_H */ 
\ No newline at end of file
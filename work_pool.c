@@ -0,0 +1,359 @@
+/**
+ * work_pool.c
+ * İş çalan (work-stealing) iş parçacığı havuzunun implementasyonları
+ */
+
+#include "work_pool.h"
+#include <pthread.h>
+
+#define WORK_DEQUE_INITIAL_CAPACITY 256
+
+/**
+ * İş parçacığına ait iş kuyruğu (dairesel, büyüyebilen dizi)
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    void** items;
+    size_t capacity;        // 2'nin kuvveti
+    size_t head;            // Çalınacak en eski iş
+    size_t tail;            // Sahibin eklediği/aldığı uç
+} WorkDeque;
+
+/**
+ * Havuz durumu
+ */
+struct WorkPool {
+    int threadCount;
+    pthread_t* threads;
+    WorkDeque* deques;
+    WorkFunction function;
+    void* context;
+    
+    long pending;           // Eklenmiş ama bitmemiş iş sayısı
+    long queued;            // Kuyruklarda bekleyen iş sayısı
+    unsigned nextDeque;     // Havuz dışından eklenen işlerin dağıtımı
+    
+    pthread_mutex_t idleLock;
+    pthread_cond_t workCond;    // Boştaki iş parçacıkları iş bekler
+    pthread_cond_t doneCond;    // waitWorkPool tüm işlerin bitmesini bekler
+    int idleCount;
+    int stopping;
+};
+
+/**
+ * İş parçacığının havuzdaki sırası (çalan iş parçacıklarının başlangıç noktası için)
+ */
+typedef struct {
+    WorkPool* pool;
+    int index;
+} WorkerStart;
+
+// --threads ile verilen varsayılan iş parçacığı sayısı (0: CPU sayısı)
+static int defaultPoolSize = 0;
+
+/**
+ * Varsayılan iş parçacığı sayısını ayarlar
+ */
+void setDefaultPoolSize(int threads) {
+    defaultPoolSize = (threads > WORK_POOL_MAX_THREADS) ? WORK_POOL_MAX_THREADS : (threads > 0 ? threads : 0);
+}
+
+/**
+ * Varsayılan iş parçacığı sayısını döndürür
+ */
+int getDefaultPoolSize() {
+    if (defaultPoolSize > 0) {
+        return defaultPoolSize;
+    }
+    
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cpus > 0) ? (int)cpus : 1;
+}
+
+/**
+ * İşi kuyruğun sonuna ekler
+ */
+static ErrorCode pushWork(WorkDeque* deque, void* item) {
+    pthread_mutex_lock(&deque->lock);
+    
+    if (deque->tail - deque->head == deque->capacity) {
+        // Kuyruğu iki katına büyüt, sırayı koru
+        size_t capacity = deque->capacity * 2;
+        void** items = malloc(sizeof(void*) * capacity);
+        if (items == NULL) {
+            pthread_mutex_unlock(&deque->lock);
+            return ERROR_UNKNOWN;
+        }
+        for (size_t i = deque->head; i != deque->tail; i++) {
+            items[i & (capacity - 1)] = deque->items[i & (deque->capacity - 1)];
+        }
+        free(deque->items);
+        deque->items = items;
+        deque->capacity = capacity;
+    }
+    
+    deque->items[deque->tail & (deque->capacity - 1)] = item;
+    deque->tail++;
+    
+    pthread_mutex_unlock(&deque->lock);
+    return SUCCESS;
+}
+
+/**
+ * Sahibin kendi kuyruğunun sonundan iş alması
+ */
+static void* popWork(WorkDeque* deque) {
+    void* item = NULL;
+    
+    pthread_mutex_lock(&deque->lock);
+    if (deque->tail != deque->head) {
+        deque->tail--;
+        item = deque->items[deque->tail & (deque->capacity - 1)];
+    }
+    pthread_mutex_unlock(&deque->lock);
+    
+    return item;
+}
+
+/**
+ * Başka bir kuyruğun başından iş çalma
+ */
+static void* stealWork(WorkDeque* deque) {
+    void* item = NULL;
+    
+    // Boş kuyruklar kilitlenmeden geçilir
+    if (__atomic_load_n(&deque->tail, __ATOMIC_RELAXED) == __atomic_load_n(&deque->head, __ATOMIC_RELAXED)) {
+        return NULL;
+    }
+    
+    if (pthread_mutex_trylock(&deque->lock) != 0) {
+        return NULL;
+    }
+    if (deque->tail != deque->head) {
+        item = deque->items[deque->head & (deque->capacity - 1)];
+        deque->head++;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    
+    return item;
+}
+
+/**
+ * Önce kendi kuyruğundan, sonra sırayla diğer kuyruklardan iş bulur
+ */
+static void* findWork(WorkPool* pool, int index) {
+    void* item = popWork(&pool->deques[index]);
+    
+    for (int i = 1; item == NULL && i < pool->threadCount; i++) {
+        item = stealWork(&pool->deques[(index + i) % pool->threadCount]);
+    }
+    
+    if (item != NULL) {
+        __atomic_sub_fetch(&pool->queued, 1, __ATOMIC_ACQ_REL);
+    }
+    return item;
+}
+
+/**
+ * İş parçacığı döngüsü
+ */
+static void* workerMain(void* arg) {
+    WorkerStart* start = arg;
+    WorkPool* pool = start->pool;
+    int index = start->index;
+    
+    free(start);
+    
+    for (;;) {
+        void* item = findWork(pool, index);
+        
+        if (item != NULL) {
+            pool->function(pool, index, item);
+            
+            // Son iş bittiyse bekleyeni uyandır
+            if (__atomic_sub_fetch(&pool->pending, 1, __ATOMIC_ACQ_REL) == 0) {
+                pthread_mutex_lock(&pool->idleLock);
+                pthread_cond_broadcast(&pool->doneCond);
+                pthread_mutex_unlock(&pool->idleLock);
+            }
+            continue;
+        }
+        
+        // Görünür iş yoksa uyu; kuyruk sayacı kilit altında kontrol edildiğinden
+        // ekleme sonrası gönderilen sinyal kaçırılmaz
+        pthread_mutex_lock(&pool->idleLock);
+        if (pool->stopping) {
+            pthread_mutex_unlock(&pool->idleLock);
+            break;
+        }
+        if (__atomic_load_n(&pool->queued, __ATOMIC_ACQUIRE) == 0) {
+            pool->idleCount++;
+            pthread_cond_wait(&pool->workCond, &pool->idleLock);
+            pool->idleCount--;
+        }
+        pthread_mutex_unlock(&pool->idleLock);
+    }
+    
+    return NULL;
+}
+
+/**
+ * Havuzu oluşturur ve iş parçacıklarını başlatır
+ */
+WorkPool* createWorkPool(int threads, WorkFunction function, void* context) {
+    WorkPool* pool;
+    
+    if (function == NULL) {
+        return NULL;
+    }
+    if (threads <= 0) {
+        threads = getDefaultPoolSize();
+    }
+    if (threads > WORK_POOL_MAX_THREADS) {
+        threads = WORK_POOL_MAX_THREADS;
+    }
+    
+    pool = calloc(1, sizeof(WorkPool));
+    if (pool == NULL) {
+        return NULL;
+    }
+    
+    pool->function = function;
+    pool->context = context;
+    pool->threads = calloc((size_t)threads, sizeof(pthread_t));
+    pool->deques = calloc((size_t)threads, sizeof(WorkDeque));
+    if (pool->threads == NULL || pool->deques == NULL) {
+        free(pool->threads);
+        free(pool->deques);
+        free(pool);
+        return NULL;
+    }
+    
+    pthread_mutex_init(&pool->idleLock, NULL);
+    pthread_cond_init(&pool->workCond, NULL);
+    pthread_cond_init(&pool->doneCond, NULL);
+    
+    for (int i = 0; i < threads; i++) {
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+        pool->deques[i].capacity = WORK_DEQUE_INITIAL_CAPACITY;
+        pool->deques[i].items = malloc(sizeof(void*) * WORK_DEQUE_INITIAL_CAPACITY);
+        if (pool->deques[i].items == NULL) {
+            pool->threadCount = i + 1;
+            destroyWorkPool(pool);
+            return NULL;
+        }
+    }
+    
+    // Başlatılamayan iş parçacıkları olursa mevcutlarla devam edilir
+    for (int i = 0; i < threads; i++) {
+        WorkerStart* start = malloc(sizeof(WorkerStart));
+        if (start == NULL) {
+            break;
+        }
+        start->pool = pool;
+        start->index = i;
+        if (pthread_create(&pool->threads[i], NULL, workerMain, start) != 0) {
+            free(start);
+            break;
+        }
+        pool->threadCount = i + 1;
+    }
+    
+    if (pool->threadCount == 0) {
+        pool->threadCount = threads;
+        destroyWorkPool(pool);
+        return NULL;
+    }
+    
+    // Kullanılmayacak kuyrukları serbest bırak
+    for (int i = pool->threadCount; i < threads; i++) {
+        free(pool->deques[i].items);
+        pthread_mutex_destroy(&pool->deques[i].lock);
+    }
+    
+    return pool;
+}
+
+/**
+ * Havuza iş ekler
+ */
+ErrorCode submitWork(WorkPool* pool, int workerIndex, void* item) {
+    int index = workerIndex;
+    
+    if (index < 0 || index >= pool->threadCount) {
+        index = (int)(__atomic_fetch_add(&pool->nextDeque, 1, __ATOMIC_RELAXED) % (unsigned)pool->threadCount);
+    }
+    
+    __atomic_add_fetch(&pool->pending, 1, __ATOMIC_ACQ_REL);
+    if (pushWork(&pool->deques[index], item) != SUCCESS) {
+        __atomic_sub_fetch(&pool->pending, 1, __ATOMIC_ACQ_REL);
+        return ERROR_UNKNOWN;
+    }
+    __atomic_add_fetch(&pool->queued, 1, __ATOMIC_ACQ_REL);
+    
+    // Boştaki bir iş parçacığını uyandır
+    pthread_mutex_lock(&pool->idleLock);
+    if (pool->idleCount > 0) {
+        pthread_cond_signal(&pool->workCond);
+    }
+    pthread_mutex_unlock(&pool->idleLock);
+    
+    return SUCCESS;
+}
+
+/**
+ * Eklenen tüm işler bitene kadar bekler
+ */
+void waitWorkPool(WorkPool* pool) {
+    pthread_mutex_lock(&pool->idleLock);
+    while (__atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE) > 0) {
+        pthread_cond_wait(&pool->doneCond, &pool->idleLock);
+    }
+    pthread_mutex_unlock(&pool->idleLock);
+}
+
+/**
+ * İş parçacıklarını durdurur ve havuzu serbest bırakır
+ */
+void destroyWorkPool(WorkPool* pool) {
+    if (pool == NULL) {
+        return;
+    }
+    
+    pthread_mutex_lock(&pool->idleLock);
+    pool->stopping = 1;
+    pthread_cond_broadcast(&pool->workCond);
+    pthread_mutex_unlock(&pool->idleLock);
+    
+    for (int i = 0; i < pool->threadCount; i++) {
+        if (pool->threads[i] != 0) {
+            pthread_join(pool->threads[i], NULL);
+        }
+    }
+    
+    for (int i = 0; i < pool->threadCount; i++) {
+        free(pool->deques[i].items);
+        pthread_mutex_destroy(&pool->deques[i].lock);
+    }
+    
+    pthread_cond_destroy(&pool->doneCond);
+    pthread_cond_destroy(&pool->workCond);
+    pthread_mutex_destroy(&pool->idleLock);
+    free(pool->deques);
+    free(pool->threads);
+    free(pool);
+}
+
+/**
+ * Havuzdaki iş parçacığı sayısını döndürür
+ */
+int getWorkPoolSize(const WorkPool* pool) {
+    return pool->threadCount;
+}
+
+/**
+ * Havuz oluşturulurken verilen paylaşılan veriyi döndürür
+ */
+void* getWorkPoolContext(const WorkPool* pool) {
+    return pool->context;
+}
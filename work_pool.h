@@ -0,0 +1,93 @@
+/**
+ * work_pool.h
+ * İş çalan (work-stealing) iş parçacığı havuzu için fonksiyon tanımlamaları
+ *
+ * Her iş parçacığının kendi iş kuyruğu vardır. İş parçacığı kendi eklediği
+ * işleri kuyruğun sonundan (derinlik öncelikli) alır; kuyruğu boşalınca
+ * diğer kuyrukların başından (en eski, genellikle en büyük işleri) çalar.
+ */
+
+#ifndef WORK_POOL_H
+#define WORK_POOL_H
+
+#include "file_system.h"
+
+#define WORK_POOL_MAX_THREADS 256
+
+typedef struct WorkPool WorkPool;
+
+/**
+ * Havuzda çalıştırılan iş fonksiyonu
+ * 
+ * @param pool İşi çalıştıran havuz (yeni iş eklemek için)
+ * @param workerIndex İşi çalıştıran iş parçacığının sırası (0..threadCount-1)
+ * @param item İş verisi
+ */
+typedef void (*WorkFunction)(WorkPool* pool, int workerIndex, void* item);
+
+/**
+ * Havuz oluşturulurken thread sayısı verilmezse kullanılacak değeri ayarlar
+ * 
+ * @param threads İş parçacığı sayısı (0: çevrimiçi CPU sayısı)
+ */
+void setDefaultPoolSize(int threads);
+
+/**
+ * Varsayılan iş parçacığı sayısını döndürür
+ * 
+ * @return --threads ile verilen değer, verilmediyse çevrimiçi CPU sayısı
+ */
+int getDefaultPoolSize();
+
+/**
+ * Havuzu oluşturur ve iş parçacıklarını başlatır
+ * 
+ * @param threads İş parçacığı sayısı (0: varsayılan)
+ * @param function Her iş için çağrılacak fonksiyon
+ * @param context İş fonksiyonlarının paylaştığı veri
+ * @return Havuz, oluşturulamazsa NULL
+ */
+WorkPool* createWorkPool(int threads, WorkFunction function, void* context);
+
+/**
+ * Havuza iş ekler
+ * 
+ * @param pool Havuz
+ * @param workerIndex Ekleyen iş parçacığının sırası (havuz dışından -1)
+ * @param item İş verisi
+ * @return Başarı durumu
+ */
+ErrorCode submitWork(WorkPool* pool, int workerIndex, void* item);
+
+/**
+ * Eklenen tüm işler (ve onların eklediği işler) bitene kadar bekler
+ * 
+ * @param pool Havuz
+ */
+void waitWorkPool(WorkPool* pool);
+
+/**
+ * İş parçacıklarını durdurur ve havuzu serbest bırakır. Önce waitWorkPool
+ * çağrılmalıdır; kuyrukta kalan işler çalıştırılmaz.
+ * 
+ * @param pool Havuz
+ */
+void destroyWorkPool(WorkPool* pool);
+
+/**
+ * Havuzdaki iş parçacığı sayısını döndürür
+ * 
+ * @param pool Havuz
+ * @return İş parçacığı sayısı
+ */
+int getWorkPoolSize(const WorkPool* pool);
+
+/**
+ * Havuz oluşturulurken verilen paylaşılan veriyi döndürür
+ * 
+ * @param pool Havuz
+ * @return Paylaşılan veri
+ */
+void* getWorkPoolContext(const WorkPool* pool);
+
+#endif /* WORK_POOL_H */